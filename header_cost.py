@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+"""Report the preprocessed size and parse time of each header.
+
+Each header is included on its own in an otherwise empty translation unit.
+The preprocessed size is measured with -E, and the parse time is the fastest
+of several runs with -fsyntax-only, so this works with gcc and clang.
+"""
+import argparse
+import os
+import shlex
+import subprocess
+import tempfile
+import time
+
+def headers(include_dir, with_detail):
+    result = []
+    for root, subdirs, files in os.walk(os.path.join(include_dir, 'fit')):
+        if 'detail' in root and not with_detail:
+            continue
+        for f in files:
+            if f.endswith('.hpp'):
+                result.append(os.path.relpath(os.path.join(root, f), include_dir).replace(os.sep, '/'))
+    return sorted(result)
+
+def measure(compiler, flags, include_dir, header, runs):
+    fd, source = tempfile.mkstemp(suffix='.cpp')
+    with os.fdopen(fd, 'w') as f:
+        f.write('#include <{0}>\n'.format(header))
+    try:
+        command = [compiler] + flags + ['-I', include_dir, source]
+        pre = subprocess.check_output(command + ['-E'])
+        times = []
+        for _ in range(runs):
+            start = time.time()
+            subprocess.check_call(command + ['-fsyntax-only'])
+            times.append(time.time() - start)
+        return len(pre), pre.count(b'\n'), min(times)
+    finally:
+        os.remove(source)
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--compiler', default='c++')
+    parser.add_argument('--flags', default='', help='Flags passed to the compiler')
+    parser.add_argument('--runs', type=int, default=3)
+    parser.add_argument('--detail', action='store_true', help='Also measure the detail headers')
+    parser.add_argument('--csv', help='Also write the results to this file')
+    parser.add_argument('include_dir')
+    args = parser.parse_args()
+
+    flags = shlex.split(args.flags)
+    results = [(h,) + measure(args.compiler, flags, args.include_dir, h, args.runs) for h in headers(args.include_dir, args.detail)]
+    results.sort(key=lambda x: x[3], reverse=True)
+
+    print('{0:<32} {1:>12} {2:>10} {3:>10}'.format('header', 'bytes', 'lines', 'parse ms'))
+    for h, size, lines, t in results:
+        print('{0:<32} {1:>12} {2:>10} {3:>10.1f}'.format(h, size, lines, t * 1000))
+
+    if args.csv:
+        with open(args.csv, 'w') as f:
+            f.write('header,bytes,lines,parse_ms\n')
+            for h, size, lines, t in results:
+                f.write('{0},{1},{2},{3:.1f}\n'.format(h, size, lines, t * 1000))
+
+if __name__ == '__main__':
+    main()
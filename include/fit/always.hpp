@@ -9,6 +9,7 @@
 #define FIT_GUARD_FUNCTION_ALWAYS_H
 
 #include <fit/detail/unwrap.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/static_const_var.hpp>
 
 /// always
@@ -127,18 +128,8 @@ struct always_f
     }
 };
 
-struct always_ref_f
-{
-    template<class T>
-    constexpr detail::always_base<T&> operator()(T& x) const
-    {
-        return detail::always_base<T&>(x);
-    }
-};
-
 }
 FIT_DECLARE_STATIC_VAR(always, detail::always_f);
-FIT_DECLARE_STATIC_VAR(always_ref, detail::always_ref_f);
 
 } // namespace fit
 
@@ -69,8 +69,7 @@
 #endif
 
 #if FIT_NO_ORDERD_BRACE_INIT
-#include <fit/pack.hpp>
-#include <fit/capture.hpp>
+#include <fit/detail/seq.hpp>
 #endif
 
 namespace fit {
@@ -78,16 +77,46 @@ namespace fit {
 namespace detail {
 
 #if FIT_NO_ORDERD_BRACE_INIT
-template<class R, class F, class Pack>
-constexpr R eval_ordered(const F& f, Pack&& p)
+template<std::size_t I, class T>
+struct eval_ordered_element
 {
-    return p(f);
+    T value;
+
+    template<class X>
+    constexpr eval_ordered_element(X&& x) : value(fit::eval(fit::forward<X>(x)))
+    {}
+};
+
+template<std::size_t I, class T>
+constexpr T&& eval_ordered_get(eval_ordered_element<I, T>& x)
+{
+    return static_cast<T&&>(x.value);
+}
+
+// The bases are initialized in the order they are declared, so the
+// arguments are evaluated from left to right
+template<class Seq, class... Ts>
+struct eval_ordered_storage;
+
+template<std::size_t... Ns, class... Ts>
+struct eval_ordered_storage<seq<Ns...>, Ts...>
+: eval_ordered_element<Ns, decltype(fit::eval(std::declval<Ts>()))>...
+{
+    constexpr eval_ordered_storage(Ts&&... xs)
+    : eval_ordered_element<Ns, decltype(fit::eval(std::declval<Ts>()))>(fit::forward<Ts>(xs))...
+    {}
+};
+
+template<class R, class F, std::size_t... Ns, class... Ts>
+constexpr R eval_ordered_apply(const F& f, eval_ordered_storage<seq<Ns...>, Ts...>&& s)
+{
+    return apply(f, eval_ordered_get<Ns>(s)...);
 }
 
-template<class R, class F, class Pack, class T, class... Ts>
-constexpr R eval_ordered(const F& f, Pack&& p, T&& x, Ts&&... xs)
+template<class R, class F, class... Ts>
+constexpr R eval_ordered(const F& f, Ts&&... xs)
 {
-    return eval_ordered<R>(f, pack_join(fit::forward<Pack>(p), fit::pack_forward(fit::eval(x))), fit::forward<Ts>(xs)...);
+    return eval_ordered_apply<R>(f, eval_ordered_storage<typename gens<sizeof...(Ts)>::type, Ts...>(fit::forward<Ts>(xs)...));
 }
 #else
 template<class R>
@@ -127,7 +156,7 @@ struct apply_eval_f
         return
 #if FIT_NO_ORDERD_BRACE_INIT
         eval_ordered<R>
-            (f, pack(), fit::forward<Ts>(xs)...);
+            (f, fit::forward<Ts>(xs)...);
 #else
         eval_helper<R>
             {f, fit::eval(fit::forward<Ts>(xs))...}.get_result();
@@ -143,7 +172,7 @@ struct apply_eval_f
     {
 #if FIT_NO_ORDERD_BRACE_INIT
         eval_ordered<R>
-            (f, pack(), fit::forward<Ts>(xs)...);
+            (f, fit::forward<Ts>(xs)...);
 #else
         eval_helper<R>
             {f, fit::eval(fit::forward<Ts>(xs))...};
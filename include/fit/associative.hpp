@@ -0,0 +1,155 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    associative.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_ASSOCIATIVE_H
+#define FIT_GUARD_ASSOCIATIVE_H
+
+/// associative
+/// ===========
+/// 
+/// Description
+/// -----------
+/// 
+/// The `associative` function adaptor marks a binary function as associative,
+/// that is `f(f(x, y), z) == f(x, f(y, z))`. The function is called the same
+/// way, but when it is folded with [`compress`](compress.md) or
+/// [`reverse_compress`](reverse_compress.md) the arguments are combined
+/// pairwise as a balanced tree, such as `f(f(x1, x2), f(x3, x4))`, instead
+/// of one after the other. The arguments are still combined in the same
+/// order, so the function doesn't need to be commutative.
+/// 
+/// Since the calls on each level of the tree don't depend on each other, the
+/// processor can evaluate them at the same time, and the depth of the nested
+/// calls, and of the template instantiations, is logarithmic in the number of
+/// arguments.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     constexpr associative_adaptor<F> associative(F f);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     assert(associative(f)(x, y) == f(x, y));
+///     assert(compress(associative(f))(x1, x2, x3, x4) == f(f(x1, x2), f(x3, x4)));
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [BinaryCallable](concepts.md#binarycallable)
+/// * MoveConstructible
+/// 
+/// When folded, the function must be callable with any two of the arguments,
+/// and with the results of the calls, not only with the state and an
+/// argument.
+/// 
+/// Example
+/// -------
+/// 
+///     struct sum_f
+///     {
+///         template<class T, class U>
+///         constexpr T operator()(T x, U y) const
+///         {
+///             return x + y;
+///         }
+///     };
+///     assert(fit::compress(fit::associative(sum_f()))(1.0, 2.0, 3.0, 4.0) == 10.0);
+/// 
+
+#include <fit/returns.hpp>
+#include <fit/detail/callable_base.hpp>
+#include <fit/detail/delegate.hpp>
+#include <fit/detail/forward.hpp>
+#include <fit/detail/make.hpp>
+#include <fit/detail/seq.hpp>
+#include <fit/detail/static_const_var.hpp>
+
+namespace fit {
+
+template<class F>
+struct associative_adaptor : detail::callable_base<F>
+{
+    FIT_INHERIT_CONSTRUCTOR(associative_adaptor, detail::callable_base<F>);
+};
+
+namespace detail {
+
+template<std::size_t I, class T>
+struct tree_fold_element
+{
+    T&& value;
+    constexpr tree_fold_element(T&& x) : value(fit::forward<T>(x))
+    {}
+};
+
+template<std::size_t I, class T>
+constexpr T&& tree_fold_get(const tree_fold_element<I, T>& x)
+{
+    return fit::forward<T>(x.value);
+}
+
+template<class Seq, class... Ts>
+struct tree_fold_args;
+
+template<std::size_t... Ns, class... Ts>
+struct tree_fold_args<seq<Ns...>, Ts...>
+: tree_fold_element<Ns, Ts>...
+{
+    constexpr tree_fold_args(Ts&&... xs) : tree_fold_element<Ns, Ts>(fit::forward<Ts>(xs))...
+    {}
+};
+
+// Folds the arguments from B to E. In reverse, the first argument stays
+// first and the rest are taken from the last one.
+template<bool Reverse, std::size_t N, std::size_t B, std::size_t E, class=void>
+struct tree_fold_range
+{
+    template<class F, class Args>
+    constexpr auto operator()(const F& f, const Args& a) const FIT_RETURNS
+    (
+        f(
+            tree_fold_range<Reverse, N, B, (B + (E - B) / 2)>()(f, a),
+            tree_fold_range<Reverse, N, (B + (E - B) / 2), E>()(f, a)
+        )
+    );
+};
+
+template<bool Reverse, std::size_t N, std::size_t B, std::size_t E>
+struct tree_fold_range<Reverse, N, B, E, typename std::enable_if<(E == B + 1)>::type>
+{
+    template<class F, class Args>
+    constexpr auto operator()(const F&, const Args& a) const FIT_RETURNS
+    (
+        detail::tree_fold_get<(Reverse && B > 0 ? N - B : B)>(a)
+    );
+};
+
+template<bool Reverse>
+struct tree_fold
+{
+    template<class F, class... Ts>
+    constexpr auto operator()(const F& f, Ts&&... xs) const FIT_RETURNS
+    (
+        tree_fold_range<Reverse, sizeof...(Ts), 0, sizeof...(Ts)>()(
+            f,
+            tree_fold_args<typename gens<sizeof...(Ts)>::type, Ts...>(fit::forward<Ts>(xs)...)
+        )
+    );
+};
+
+}
+
+FIT_DECLARE_STATIC_VAR(associative, detail::make<associative_adaptor>);
+
+} // namespace fit
+
+#endif
@@ -0,0 +1,158 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    bounded.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_BOUNDED_H
+#define FIT_GUARD_BOUNDED_H
+
+/// bounded
+/// =======
+/// 
+/// Description
+/// -----------
+/// 
+/// The `bounded` function creates a sequence from a pointer and a length
+/// only known at runtime, that can be used with [`unpack`](unpack.md). The
+/// length must not be greater than `N`. When the sequence is unpacked, the
+/// length is used to select a call with a fixed number of arguments from a
+/// table built at compile time, so the elements are passed as references
+/// directly to the function.
+/// 
+/// The function must be callable with every number of arguments from zero up
+/// to `N`, and the result type is the common type of those calls. Since the
+/// number of elements is not known at compile time, a bounded sequence can't
+/// be unpacked together with other sequences.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<std::size_t N, class T>
+///     constexpr bounded_sequence<N, T> bounded(T* data, std::size_t size);
+/// 
+/// Requirements
+/// ------------
+/// 
+/// `size` must be less than or equal to `N`.
+/// 
+/// Example
+/// -------
+/// 
+///     struct sum_f
+///     {
+///         int operator()() const
+///         {
+///             return 0;
+///         }
+/// 
+///         template<class T, class... Ts>
+///         int operator()(T x, Ts... xs) const
+///         {
+///             return x + (*this)(xs...);
+///         }
+///     };
+/// 
+///     std::vector<int> v = { 1, 2, 3 };
+///     assert(fit::unpack(sum_f())(fit::bounded<4>(v.data(), v.size())) == 6);
+/// 
+
+#include <fit/unpack.hpp>
+#include <fit/detail/holder.hpp>
+#include <cassert>
+
+namespace fit {
+
+template<std::size_t N, class T>
+struct bounded_sequence
+{
+    T* data;
+    std::size_t size;
+
+    constexpr bounded_sequence(T* p, std::size_t n) : data(p), size(n)
+    {}
+};
+
+template<std::size_t N, class T>
+constexpr bounded_sequence<N, T> bounded(T* data, std::size_t size)
+{
+    return bounded_sequence<N, T>(data, size);
+}
+
+namespace detail {
+
+template<class F, class T, class Seq>
+struct bounded_entry;
+
+template<class F, class T, std::size_t... Ns>
+struct bounded_entry<F, T, seq<Ns...>>
+{
+    template<class G>
+    static constexpr auto apply(G&& f, T* data) FIT_RETURNS
+    (
+        f(data[Ns]...)
+    );
+
+    template<class R>
+    static constexpr R call(F&& f, T* data)
+    {
+        return static_cast<R>(apply(fit::forward<F>(f), data));
+    }
+};
+
+// The result type is only defined when the function can be called with
+// every number of elements up to N, so unpack can be used in a SFINAE
+// context
+template<class Enable, class F, class T, class Seq>
+struct bounded_result
+{};
+
+template<class F, class T, std::size_t... Ns>
+struct bounded_result<typename holder<
+    decltype(bounded_entry<F, T, typename gens<Ns>::type>::apply(std::declval<F>(), std::declval<T*>()))...
+>::type, F, T, seq<Ns...>>
+: std::common_type<
+    decltype(bounded_entry<F, T, typename gens<Ns>::type>::apply(std::declval<F>(), std::declval<T*>()))...
+>
+{};
+
+template<class F, class T, std::size_t N>
+struct bounded_result_of
+: bounded_result<void, F, T, typename gens<N+1>::type>
+{};
+
+template<class R, class F, class T, class Seq>
+struct bounded_table;
+
+template<class R, class F, class T, std::size_t... Ns>
+struct bounded_table<R, F, T, seq<Ns...>>
+{
+    typedef R(*function_type)(F&&, T*);
+
+    static constexpr function_type value[] = { &bounded_entry<F, T, typename gens<Ns>::type>::template call<R>... };
+};
+
+template<class R, class F, class T, std::size_t... Ns>
+constexpr typename bounded_table<R, F, T, seq<Ns...>>::function_type bounded_table<R, F, T, seq<Ns...>>::value[];
+
+template<class R, class F, class T, std::size_t N>
+struct bounded_table_of
+: bounded_table<R, F, T, typename gens<N+1>::type>
+{};
+
+}
+
+template<std::size_t N, class T>
+struct unpack_sequence<bounded_sequence<N, T>>
+{
+    template<class F, class S, class R=typename detail::bounded_result_of<F, T, N>::type>
+    constexpr static R apply(F&& f, S&& s)
+    {
+        return (assert(s.size <= N), detail::bounded_table_of<R, F, T, N>::value[s.size])(fit::forward<F>(f), s.data);
+    }
+};
+
+} // namespace fit
+
+#endif
@@ -66,6 +66,7 @@
 
 
 #include <utility>
+#include <fit/fwd.hpp>
 #include <fit/always.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/detail/result_of.hpp>
@@ -156,9 +157,6 @@ struct swallow
 
 }
 
-template<class Projection, class F=void>
-struct by_adaptor;
-
 template<class Projection, class F>
 struct by_adaptor : detail::callable_base<Projection>, detail::callable_base<F>
 {
@@ -114,22 +114,15 @@ struct capture_invoke : detail::callable_base<F>, Pack
     FIT_RETURNS_CLASS(capture_invoke);
 
     template<class... Ts>
-    constexpr FIT_SFINAE_RESULT
-    (
-        typename result_of<decltype(fit::pack_join), 
-            id_<const Pack&>, 
-            result_of<decltype(fit::pack_forward), id_<Ts>...> 
-        >::type,
-        id_<detail::callable_base<F>&&>
-    ) 
+    constexpr FIT_SFINAE_RESULT(pack_invoke, id_<detail::callable_base<F>&&>, id_<const Pack&>, id_<Ts>...)
     operator()(Ts&&... xs) const FIT_SFINAE_RETURNS
     (
-        fit::pack_join
+        pack_invoke()
         (
+            FIT_RETURNS_C_CAST(detail::callable_base<F>&&)(FIT_CONST_THIS->base_function(xs...)),
             FIT_MANGLE_CAST(const Pack&)(FIT_CONST_THIS->get_pack(xs...)), 
-            fit::pack_forward(fit::forward<Ts>(xs)...)
+            fit::forward<Ts>(xs)...
         )
-        (FIT_RETURNS_C_CAST(detail::callable_base<F>&&)(FIT_CONST_THIS->base_function(xs...)))
     );
 };
 
@@ -142,7 +135,7 @@ struct capture_pack : Pack
 
     // TODO: Should use rvalue ref qualifier
     template<class F>
-    constexpr auto operator()(F f) const FIT_SFINAE_RETURNS
+    constexpr auto operator()(F f) const FIT_RETURNS
     (
         capture_invoke<F, Pack>(fit::move(f), 
             FIT_RETURNS_C_CAST(Pack&&)(
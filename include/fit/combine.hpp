@@ -48,7 +48,7 @@
 /// 
 
 #include <fit/pack.hpp>
-#include <fit/always.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/detail/make.hpp>
 
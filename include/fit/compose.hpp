@@ -65,11 +65,9 @@
 /// 
 
 #include <fit/detail/callable_base.hpp>
-#include <fit/always.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/compressed_pair.hpp>
 #include <fit/detail/join.hpp>
-#include <tuple>
 #include <fit/detail/move.hpp>
 #include <fit/detail/make.hpp>
 #include <fit/detail/static_const_var.hpp>
@@ -107,7 +105,7 @@ struct compose_adaptor : detail::compose_kernel<detail::callable_base<F>, FIT_JO
 
     template<class X, class... Xs, FIT_ENABLE_IF_CONVERTIBLE(X, detail::callable_base<F>), FIT_ENABLE_IF_CONSTRUCTIBLE(tail, Xs...)>
     constexpr compose_adaptor(X&& f1, Xs&& ... fs) 
-    : base_type(fit::forward<X>(f1), tail(fit::forward<Xs>(fs)...))
+    : base_type(detail::pair_rest_tag(), fit::forward<X>(f1), fit::forward<Xs>(fs)...)
     {}
 };
 
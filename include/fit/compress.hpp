@@ -22,6 +22,9 @@
 /// The arguments to the binary function, take first the state and then the
 /// argument.
 /// 
+/// When the function is wrapped with [`associative`](associative.md), the
+/// arguments are folded pairwise as a balanced tree instead.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -65,6 +68,9 @@
 ///     assert(fit::compress(max_f())(2, 3, 4, 5) == 5);
 /// 
 
+#include <fit/fwd.hpp>
+#include <fit/associative.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/compressed_pair.hpp>
@@ -84,6 +90,12 @@ struct v_fold
         (*FIT_CONST_THIS)(f, f(fit::forward<State>(state), fit::forward<T>(x)), fit::forward<Ts>(xs)...)
     );
 
+    template<class F, class State, class T, class... Ts>
+    constexpr auto operator()(const associative_adaptor<F>& f, State&& state, T&& x, Ts&&... xs) const FIT_RETURNS
+    (
+        tree_fold<false>()(f, fit::forward<State>(state), fit::forward<T>(x), fit::forward<Ts>(xs)...)
+    );
+
     template<class F, class State>
     constexpr State operator()(const F&, State&& state) const 
     {
@@ -93,7 +105,7 @@ struct v_fold
 
 }
 
-template<class F, class State=void>
+template<class F, class State>
 struct compress_adaptor
 : detail::compressed_pair<detail::callable_base<F>, State>
 {
@@ -67,6 +67,7 @@
 /// So, the order of the functions in the `conditional_adaptor` are very important
 /// to how the function is chosen.
 
+#include <fit/detail/always_ref.hpp>
 #include <fit/reveal.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/detail/delegate.hpp>
@@ -36,6 +36,7 @@
 /// * MoveConstructible
 /// 
 
+#include <fit/detail/always_ref.hpp>
 #include <fit/reveal.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/move.hpp>
@@ -0,0 +1,46 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    always_ref.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_ALWAYS_REF_H
+#define FIT_GUARD_ALWAYS_REF_H
+
+#include <fit/detail/static_const_var.hpp>
+
+// This is kept separate from always.hpp, so the adaptors that only need
+// always_ref don't have to include <functional>.
+namespace fit { namespace detail {
+
+template<class T>
+struct always_ref_base
+{
+    T& x;
+
+    constexpr always_ref_base(T& xp) : x(xp)
+    {}
+
+    template<class... As>
+    constexpr T& operator()(As&&...) const
+    {
+        return this->x;
+    }
+};
+
+struct always_ref_f
+{
+    template<class T>
+    constexpr detail::always_ref_base<T> operator()(T& x) const
+    {
+        return detail::always_ref_base<T>(x);
+    }
+};
+
+}
+FIT_DECLARE_STATIC_VAR(always_ref, detail::always_ref_f);
+
+} // namespace fit
+
+#endif
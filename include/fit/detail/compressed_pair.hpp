@@ -11,7 +11,7 @@
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/move.hpp>
 #include <fit/detail/forward.hpp>
-#include <fit/always.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/alias.hpp>
 
 #ifndef FIT_COMPRESSED_PAIR_USE_EBO_WORKAROUND
@@ -28,6 +28,10 @@ template<int I, class T, class U>
 struct pair_tag
 {};
 
+// Constructs the second element from all of the arguments after the first
+struct pair_rest_tag
+{};
+
 #if FIT_COMPRESSED_PAIR_USE_EBO_WORKAROUND
 template<class T, class U>
 struct is_related
@@ -88,6 +92,14 @@ struct compressed_pair
     : FirstBase(fit::forward<X>(x)), SecondBase(fit::forward<Y>(y))
     {}
 
+    template<class X, class... Ys, 
+        FIT_ENABLE_IF_CONSTRUCTIBLE(First, X&&), 
+        FIT_ENABLE_IF_CONSTRUCTIBLE(Second, Ys&&...)
+    >
+    constexpr compressed_pair(pair_rest_tag, X&& x, Ys&&... ys) 
+    : FirstBase(fit::forward<X>(x)), SecondBase(fit::forward<Ys>(ys)...)
+    {}
+
     FIT_INHERIT_DEFAULT(compressed_pair, FirstBase, SecondBase)
 
     template<class Base, class... Xs>
@@ -8,16 +8,7 @@
 #ifndef FIT_GUARD_FUNCTION_CONSTEXPR_DEDUCE_H
 #define FIT_GUARD_FUNCTION_CONSTEXPR_DEDUCE_H
 
-
-#ifndef FIT_NO_UNIQUE_STATIC_LAMBDA_FUNCTION_ADDR
-#if defined(_MSC_VER)
-#define FIT_NO_UNIQUE_STATIC_LAMBDA_FUNCTION_ADDR 1
-#else
-#define FIT_NO_UNIQUE_STATIC_LAMBDA_FUNCTION_ADDR 0
-#endif
-#endif
-
-#define FIT_CONST_FOLD(x) (__builtin_constant_p(x) ? (x) : (x))
+#include <fit/detail/constexpr_deduce_macros.hpp>
 
 namespace fit {
 
@@ -58,13 +49,4 @@ struct constexpr_deduce_unique
 
 }} // namespace fit
 
-#define FIT_DETAIL_CONSTEXPR_DEDUCE true ? fit::detail::constexpr_deduce() :
-#define FIT_DETAIL_CONSTEXPR_DEDUCE_UNIQUE(T) true ? fit::detail::constexpr_deduce_unique<T>() :
-
-#ifdef _MSC_VER
-#define FIT_DETAIL_MSVC_CONSTEXPR_DEDUCE FIT_DETAIL_CONSTEXPR_DEDUCE
-#else
-#define FIT_DETAIL_MSVC_CONSTEXPR_DEDUCE
-#endif
-
 #endif
@@ -0,0 +1,32 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    constexpr_deduce_macros.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_CONSTEXPR_DEDUCE_MACROS_H
+#define FIT_GUARD_CONSTEXPR_DEDUCE_MACROS_H
+
+// The macros of constexpr_deduce.hpp, which don't need any declarations
+
+#ifndef FIT_NO_UNIQUE_STATIC_LAMBDA_FUNCTION_ADDR
+#if defined(_MSC_VER)
+#define FIT_NO_UNIQUE_STATIC_LAMBDA_FUNCTION_ADDR 1
+#else
+#define FIT_NO_UNIQUE_STATIC_LAMBDA_FUNCTION_ADDR 0
+#endif
+#endif
+
+#define FIT_CONST_FOLD(x) (__builtin_constant_p(x) ? (x) : (x))
+
+#define FIT_DETAIL_CONSTEXPR_DEDUCE true ? fit::detail::constexpr_deduce() :
+#define FIT_DETAIL_CONSTEXPR_DEDUCE_UNIQUE(T) true ? fit::detail::constexpr_deduce_unique<T>() :
+
+#ifdef _MSC_VER
+#define FIT_DETAIL_MSVC_CONSTEXPR_DEDUCE FIT_DETAIL_CONSTEXPR_DEDUCE
+#else
+#define FIT_DETAIL_MSVC_CONSTEXPR_DEDUCE
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    function_macros.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_FUNCTION_MACROS_H
+#define FIT_GUARD_FUNCTION_MACROS_H
+
+// The macros of function.hpp, which don't need any declarations
+
+#include <fit/detail/constexpr_deduce_macros.hpp>
+#include <fit/detail/static_const_var_macros.hpp>
+#include <fit/detail/static_constexpr.hpp>
+
+#if FIT_NO_UNIQUE_STATIC_VAR
+#define FIT_STATIC_FUNCTION(name) FIT_STATIC_CONSTEXPR auto name = FIT_DETAIL_MSVC_CONSTEXPR_DEDUCE fit::detail::reveal_static_const_factory()
+#else
+#define FIT_STATIC_FUNCTION(name) FIT_STATIC_AUTO_REF name = fit::detail::reveal_static_const_factory()
+#endif
+
+#endif
@@ -0,0 +1,25 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    lift_macros.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_LIFT_MACROS_H
+#define FIT_GUARD_LIFT_MACROS_H
+
+// The macros of lift.hpp, which don't need any declarations
+
+#include <fit/detail/returns_macros.hpp>
+
+#define FIT_LIFT(...) [](auto&&... xs) FIT_RETURNS(__VA_ARGS__(fit::forward<decltype(xs)>(xs)...))
+
+#define FIT_LIFT_CLASS(name, ...) \
+struct name \
+{ \
+    template<class... Ts> \
+    constexpr auto operator()(Ts&&... xs) const \
+    FIT_RETURNS(__VA_ARGS__(fit::forward<Ts>(xs)...)) \
+}
+
+#endif
@@ -8,8 +8,9 @@
 #ifndef FIT_GUARD_MAKE_H
 #define FIT_GUARD_MAKE_H
 
-#include <fit/detail/move.hpp>
+#include <fit/detail/forward.hpp>
 #include <fit/detail/join.hpp>
+#include <type_traits>
 
 namespace fit { namespace detail {
 
@@ -18,10 +19,12 @@ struct make
 {
 	constexpr make()
 	{}
-    template<class... Fs, class Result=FIT_JOIN(Adaptor, Fs...)>
-    constexpr Result operator()(Fs... fs) const
+    // The functions are forwarded to the constructor of the adaptor, so they
+    // are copied or moved only once into it
+    template<class... Fs, class Result=FIT_JOIN(Adaptor, typename std::decay<Fs>::type...)>
+    constexpr Result operator()(Fs&&... fs) const
     {
-        return Result(fit::move(fs)...);
+        return Result(fit::forward<Fs>(fs)...);
     }
 };
 
@@ -0,0 +1,91 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    named_adaptor.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_NAMED_ADAPTOR_H
+#define FIT_GUARD_NAMED_ADAPTOR_H
+
+#include <fit/reveal.hpp>
+#include <fit/returns.hpp>
+#include <fit/detail/always_ref.hpp>
+#include <fit/detail/callable_base.hpp>
+#include <fit/detail/delegate.hpp>
+#include <fit/detail/forward.hpp>
+#include <fit/detail/result_of.hpp>
+#include <fit/detail/type_name.hpp>
+#include <ostream>
+#include <type_traits>
+
+namespace fit { namespace detail {
+
+inline void write_json_string(std::ostream& os, const char* s)
+{
+    static const char hex[] = "0123456789abcdef";
+    os << '"';
+    for (; *s != 0; s++)
+    {
+        unsigned char c = *s;
+        if (c == '"' || c == '\\') os << '\\' << *s;
+        else if (c < 0x20) os << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+        else os << *s;
+    }
+    os << '"';
+}
+
+// A function with a name, which is the name of its type unless one is given.
+// Each call is made inside a Scope constructed from the name, or directly
+// when the Scope is void.
+template<class F, class Scope>
+struct named_adaptor : callable_base<F>
+{
+    const char* name = nullptr;
+
+    FIT_INHERIT_DEFAULT(named_adaptor, callable_base<F>)
+
+    template<class X, class=typename std::enable_if<(
+        std::is_convertible<X, callable_base<F>>::value &&
+        !std::is_base_of<named_adaptor, typename std::decay<X>::type>::value
+    )>::type>
+    constexpr named_adaptor(X&& x, const char* n=nullptr)
+    : callable_base<F>(fit::forward<X>(x)), name(n)
+    {}
+
+    template<class... Ts>
+    constexpr const callable_base<F>& base_function(Ts&&... xs) const
+    {
+        return always_ref(*this)(xs...);
+    }
+
+    const char* get_name() const
+    {
+        return this->name == nullptr ? type_name<F>() : this->name;
+    }
+
+    struct failure
+    : failure_for<callable_base<F>>
+    {};
+
+    template<class... Ts, class S=Scope, class=typename std::enable_if<!std::is_void<S>::value>::type>
+    auto operator()(Ts&&... xs) const
+    -> decltype(std::declval<const callable_base<F>&>()(std::declval<Ts>()...))
+    {
+        S scope(this->get_name());
+        return this->base_function(xs...)(fit::forward<Ts>(xs)...);
+    }
+
+    FIT_RETURNS_CLASS(named_adaptor);
+
+    template<class... Ts, class S=Scope, class=typename std::enable_if<std::is_void<S>::value>::type>
+    constexpr FIT_SFINAE_RESULT(const callable_base<F>&, id_<Ts>...)
+    operator()(Ts&&... xs) const FIT_SFINAE_RETURNS
+    (
+        FIT_MANGLE_CAST(const callable_base<F>&)(FIT_CONST_THIS->base_function(xs...))(fit::forward<Ts>(xs)...)
+    );
+};
+
+}} // namespace fit
+
+#endif
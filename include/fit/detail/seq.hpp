@@ -8,7 +8,7 @@
 #ifndef FIT_GUARD_FUNCTION_DETAIL_SEQ_H
 #define FIT_GUARD_FUNCTION_DETAIL_SEQ_H
 
-#include <cstdlib>
+#include <cstddef>
 
 namespace fit { 
 
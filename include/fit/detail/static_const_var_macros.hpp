@@ -0,0 +1,49 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    static_const_var_macros.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_STATIC_CONST_VAR_MACROS_H
+#define FIT_GUARD_STATIC_CONST_VAR_MACROS_H
+
+// The macros of static_const_var.hpp, which don't need any declarations
+
+#if defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 7
+#define FIT_STATIC_AUTO_REF static auto&
+#else
+#define FIT_STATIC_AUTO_REF static constexpr auto&
+#endif
+
+#ifndef FIT_NO_UNIQUE_STATIC_VAR
+#if (defined(__GNUC__) && !defined (__clang__) && __GNUC__ == 4 && __GNUC_MINOR__ < 7) || defined(_MSC_VER)
+#define FIT_NO_UNIQUE_STATIC_VAR 1
+#else
+#define FIT_NO_UNIQUE_STATIC_VAR 0
+#endif
+#endif
+
+#ifndef FIT_HAS_INLINE_VARIABLES
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+#define FIT_HAS_INLINE_VARIABLES 1
+#else
+#define FIT_HAS_INLINE_VARIABLES 0
+#endif
+#endif
+
+// With inline variables, the function objects have external linkage, so
+// they can also be exported from a module
+#if FIT_NO_UNIQUE_STATIC_VAR
+#if FIT_HAS_INLINE_VARIABLES
+#define FIT_DECLARE_STATIC_VAR(name, ...) inline constexpr __VA_ARGS__ name = {}
+#else
+#define FIT_DECLARE_STATIC_VAR(name, ...) static constexpr __VA_ARGS__ name = {}
+#endif
+#elif FIT_HAS_INLINE_VARIABLES
+#define FIT_DECLARE_STATIC_VAR(name, ...) inline constexpr auto& name = fit::static_const_var<__VA_ARGS__>()
+#else
+#define FIT_DECLARE_STATIC_VAR(name, ...) static constexpr auto& name = fit::static_const_var<__VA_ARGS__>()
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    type_name.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_TYPE_NAME_H
+#define FIT_GUARD_TYPE_NAME_H
+
+#include <string>
+#include <typeinfo>
+#include <cstdlib>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+namespace fit { namespace detail {
+
+inline std::string demangle(const char* name)
+{
+#if defined(__GNUC__)
+    int status = 0;
+    char* s = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 && s != nullptr)
+    {
+        std::string result = s;
+        std::free(s);
+        return result;
+    }
+#endif
+    return name;
+}
+
+// Returns the same pointer for every call with the same type, so it can be
+// used as a key
+template<class T>
+const char* type_name()
+{
+    static const std::string name = demangle(typeid(T).name());
+    return name.c_str();
+}
+
+}} // namespace fit
+
+#endif
@@ -39,7 +39,7 @@
 ///     assert(fit::eval([]{ return 3; }) == 3);
 /// 
 
-#include <fit/always.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/identity.hpp>
 #include <fit/conditional.hpp>
 #include <fit/detail/result_of.hpp>
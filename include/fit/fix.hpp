@@ -17,9 +17,14 @@
 /// The `fix` function adaptor implements a fixed-point combinator. This can be
 /// used to write recursive functions. 
 /// 
-/// Note: Compilers are too eager to instantiate templates when using
-/// constexpr, which causes the compiler to reach its internal instantiation
-/// limit. So, unfortunately, `fix` cannot be used for `constexpr` functions.
+/// On compilers with relaxed `constexpr` (C++14), `FIT_FIX_HAS_CONSTEXPR` is
+/// 1 and the recursive function can be evaluated in a constant expression, as
+/// long as the function is `constexpr` too. This can be used to compute
+/// values, such as lookup tables, at compile time instead of at startup. On
+/// older compilers, which are too eager to instantiate templates when using
+/// `constexpr` and reach their internal instantiation limit, it is 0 and
+/// `fix` cannot be used for `constexpr` functions. The `FIT_FIX_CONSTEXPR`
+/// macro can be used on the function to follow this setting.
 /// 
 /// Synopsis
 /// --------
@@ -46,18 +51,34 @@
 ///     int r = fit::fix([](auto s, auto x) -> decltype(x) { return x == 0 ? 1 : x * s(x-1); })(5);
 ///     assert(r == 5*4*3*2*1);
 /// 
+///     struct fibonacci_f
+///     {
+///         template<class Self>
+///         FIT_FIX_CONSTEXPR int operator()(Self self, int n) const
+///         {
+///             return n < 2 ? n : self(n-1) + self(n-2);
+///         }
+///     };
+/// 
+///     static_assert(fit::fix(fibonacci_f())(10) == 55, "Computed at compile time");
+/// 
 
-#include <fit/always.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/reveal.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/move.hpp>
 #include <fit/detail/make.hpp>
 #include <fit/detail/static_const_var.hpp>
+#include <fit/detail/static_constexpr.hpp>
 
 #ifndef FIT_FIX_HAS_CONSTEXPR
+#if FIT_HAS_RELAXED_CONSTEXPR || (defined(__cpp_constexpr) && __cpp_constexpr >= 201304L)
+#define FIT_FIX_HAS_CONSTEXPR 1
+#else
 #define FIT_FIX_HAS_CONSTEXPR 0
 #endif
+#endif
 
 #if FIT_FIX_HAS_CONSTEXPR
 #define FIT_FIX_CONSTEXPR constexpr
@@ -42,6 +42,7 @@
 ///     assert(r == 3);
 /// 
 
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/reveal.hpp>
 #include <fit/detail/make.hpp>
@@ -65,11 +65,9 @@
 /// 
 
 #include <fit/detail/callable_base.hpp>
-#include <fit/always.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/compressed_pair.hpp>
 #include <fit/detail/join.hpp>
-#include <tuple>
 #include <fit/detail/move.hpp>
 #include <fit/detail/make.hpp>
 #include <fit/detail/static_const_var.hpp>
@@ -107,7 +105,7 @@ struct flow_adaptor : detail::flow_kernel<F, FIT_JOIN(flow_adaptor, Fs...)>
 
     template<class X, class... Xs, FIT_ENABLE_IF_CONVERTIBLE(X, F), FIT_ENABLE_IF_CONSTRUCTIBLE(tail, Xs...)>
     constexpr flow_adaptor(X&& f1, Xs&& ... fs) 
-    : base(fit::forward<X>(f1), tail(fit::forward<Xs>(fs)...))
+    : base(detail::pair_rest_tag(), fit::forward<X>(f1), fit::forward<Xs>(fs)...)
     {}
 };
 
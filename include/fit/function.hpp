@@ -40,6 +40,7 @@
 #include <fit/detail/static_constexpr.hpp>
 #include <fit/detail/static_const_var.hpp>
 #include <fit/detail/constexpr_deduce.hpp>
+#include <fit/detail/function_macros.hpp>
 
 namespace fit {
 
@@ -67,11 +68,5 @@ struct reveal_static_const_factory
 };
 }} // namespace fit
 
-#if FIT_NO_UNIQUE_STATIC_VAR
-#define FIT_STATIC_FUNCTION(name) FIT_STATIC_CONSTEXPR auto name = FIT_DETAIL_MSVC_CONSTEXPR_DEDUCE fit::detail::reveal_static_const_factory()
-#else
-#define FIT_STATIC_FUNCTION(name) FIT_STATIC_AUTO_REF name = fit::detail::reveal_static_const_factory()
-#endif
-
 
 #endif
@@ -0,0 +1,171 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    fwd.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_FWD_H
+#define FIT_GUARD_FWD_H
+
+/// fwd
+/// ===
+/// 
+/// Description
+/// -----------
+/// 
+/// The `fwd.hpp` header forward declares the adaptor templates and the
+/// customization points of the library, without including anything else. It
+/// can be used in headers that only need to name the types, or to
+/// specialize `unpack_sequence` or `variant_traits`, and the full header
+/// only needs to be included where the functions are called.
+/// 
+/// The function objects, such as `fit::compose`, can't be forward declared,
+/// since they are `constexpr` variables which must be defined where they are
+/// declared. The header of the function must be included to use them.
+/// 
+/// Example
+/// -------
+/// 
+///     #include <fit/fwd.hpp>
+/// 
+///     struct increment;
+///     struct square;
+///     // The definition can be in a separate source file that includes
+///     // <fit/compose.hpp>
+///     int apply_twice(const fit::compose_adaptor<increment, square>& f, int x);
+/// 
+
+#include <cstddef>
+
+namespace fit {
+
+template<class F>
+struct associative_adaptor;
+
+template<class Projection, class F=void>
+struct by_adaptor;
+
+template<class Key, class F>
+struct case_adaptor;
+
+template<class F, class... Gs>
+struct combine_adaptor;
+
+template<class F, class... Fs>
+struct compose_adaptor;
+
+template<class F, class State=void>
+struct compress_adaptor;
+
+template<class... Fs>
+struct conditional_adaptor;
+
+template<class F>
+struct decorate_adaptor;
+
+template<class F>
+struct default_adaptor;
+
+template<class F>
+struct fix_adaptor;
+
+template<class F>
+struct flip_adaptor;
+
+template<class F, class... Fs>
+struct flow_adaptor;
+
+template<template <class...> class F>
+struct implicit;
+
+template<class F>
+struct indirect_adaptor;
+
+template<class F>
+struct infix_adaptor;
+
+template<class F>
+struct lazy_adaptor;
+
+template<class... Fs>
+struct match_adaptor;
+
+template<class F>
+struct mutable_adaptor;
+
+template<class F, class Pack=void>
+struct partial_adaptor;
+
+template<class F>
+struct pipable_adaptor;
+
+template<int N>
+struct placeholder;
+
+template<class Op, class... Ts>
+struct placeholder_expression;
+
+template<class F>
+struct profile_adaptor;
+
+template<class F>
+struct protect_adaptor;
+
+template<class F, bool Deterministic=false>
+struct reduce_adaptor;
+
+template<class Result, class F>
+struct result_adaptor;
+
+template<class F>
+struct reveal_adaptor;
+
+template<class F, class State=void>
+struct reverse_compress_adaptor;
+
+template<class F>
+struct rotate_adaptor;
+
+template<class F, bool Atomic=true>
+struct shared_adaptor;
+
+template<class F>
+struct static_;
+
+template<class... Cases>
+struct switch_adaptor;
+
+template<std::size_t N, class F>
+struct table_adaptor;
+
+template<class F, class Merge=void>
+struct thread_local_adaptor;
+
+template<class F>
+struct thunk_adaptor;
+
+template<class F>
+struct trace_adaptor;
+
+template<class F>
+struct unpack_adaptor;
+
+template<class P, class F>
+struct when_adaptor;
+
+template<std::size_t N, class T>
+struct bounded_sequence;
+
+template<class... Ts>
+struct pack_view_sequence;
+
+template<class Sequence, class=void>
+struct unpack_sequence;
+
+template<class Variant, class=void>
+struct variant_traits;
+
+} // namespace fit
+
+#endif
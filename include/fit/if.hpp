@@ -57,7 +57,6 @@
 ///     assert(sum_f()("", "") == 0);
 /// 
 
-#include <fit/always.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/detail/forward.hpp>
 #include <fit/detail/delegate.hpp>
@@ -55,7 +55,7 @@
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/result_of.hpp>
 #include <fit/reveal.hpp>
-#include <fit/always.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/move.hpp>
 #include <fit/detail/make.hpp>
 #include <fit/detail/static_const_var.hpp>
@@ -56,7 +56,7 @@
 
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/callable_base.hpp>
-#include <fit/always.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/move.hpp>
 #include <fit/detail/make.hpp>
 #include <fit/detail/static_const_var.hpp>
@@ -52,17 +52,7 @@
 #include <fit/detail/constexpr_deduce.hpp>
 #include <fit/detail/static_constexpr.hpp>
 #include <fit/detail/static_const_var.hpp>
-
-
-#define FIT_HAS_STATIC_LAMBDA 1
-
-#ifndef FIT_REWRITE_STATIC_LAMBDA
-#ifdef _MSC_VER
-#define FIT_REWRITE_STATIC_LAMBDA 1
-#else
-#define FIT_REWRITE_STATIC_LAMBDA 0
-#endif
-#endif
+#include <fit/detail/lambda_macros.hpp>
 
 namespace fit {
 
@@ -205,19 +195,5 @@ struct reveal_static_lambda_function_wrapper_factor
 
 }} // namespace fit
 
-#if FIT_NO_UNIQUE_STATIC_LAMBDA_FUNCTION_ADDR || FIT_REWRITE_STATIC_LAMBDA
-#define FIT_DETAIL_STATIC_FUNCTION_AUTO FIT_STATIC_CONSTEXPR auto
-#else
-#define FIT_DETAIL_STATIC_FUNCTION_AUTO FIT_STATIC_AUTO_REF
-#endif
-
-#define FIT_DETAIL_MAKE_STATIC FIT_DETAIL_CONSTEXPR_DEDUCE fit::detail::static_function_wrapper_factor()
-#define FIT_DETAIL_MAKE_REVEAL_STATIC(T) FIT_DETAIL_CONSTEXPR_DEDUCE_UNIQUE(T) fit::detail::reveal_static_lambda_function_wrapper_factor<T>()
-#define FIT_STATIC_LAMBDA_FUNCTION(name) \
-struct fit_private_static_function_ ## name {}; \
-FIT_DETAIL_STATIC_FUNCTION_AUTO name = FIT_DETAIL_MAKE_REVEAL_STATIC(fit_private_static_function_ ## name)
-
-#define FIT_STATIC_LAMBDA FIT_DETAIL_MAKE_STATIC = []
-
 
 #endif
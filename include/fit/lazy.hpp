@@ -49,8 +49,7 @@
 
 #include <fit/arg.hpp>
 #include <fit/conditional.hpp>
-#include <fit/always.hpp>
-#include <fit/static.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/compressed_pair.hpp>
 #include <fit/pack.hpp>
@@ -103,14 +102,14 @@ struct ref_transformer
 {
     template<class T, typename std::enable_if<is_reference_wrapper<T>::value, int>::type = 0>
     constexpr auto operator()(T x) const 
-    FIT_SFINAE_RETURNS(always_ref(x.get()));
+    FIT_RETURNS(always_ref(x.get()));
 };
 
 struct id_transformer
 {
     template<class T>
     constexpr auto operator()(const T& x) const 
-    FIT_SFINAE_RETURNS(always_ref(x));
+    FIT_RETURNS(always_ref(x));
 };
 
 FIT_DECLARE_STATIC_VAR(pick_transformer, conditional_adaptor<placeholder_transformer, bind_transformer, ref_transformer, id_transformer>);
@@ -0,0 +1,60 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    macros.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_MACROS_H
+#define FIT_GUARD_MACROS_H
+
+/// macros
+/// ======
+/// 
+/// Description
+/// -----------
+/// 
+/// When `FIT_BUILD_MODULE` is enabled in cmake, the library is also built as
+/// the C++20 module `fit`, which can be imported instead of including the
+/// headers. The module has a partition for the adaptors and functions
+/// (`fit:adaptors`), for [`pack`](pack.md) (`fit:pack`), for the
+/// [placeholders](placeholders.md) and their operators (`fit:placeholders`),
+/// and for the building blocks used to write new adaptors (`fit:detail`).
+/// Importing `fit` imports all of them.
+/// 
+/// A module can't export macros, so `FIT_RETURNS`, `FIT_STATIC_FUNCTION`,
+/// `FIT_STATIC_LAMBDA` and `FIT_LIFT` are made available by including the
+/// `<fit/macros.hpp>` header along with the import. The header only defines
+/// the macros, and they expand to names exported by the module, so it
+/// doesn't parse the library again. It can also be used without the module,
+/// along with the headers of the functions that are used.
+/// 
+/// The module is experimental, since it hasn't been built by a compiler that
+/// supports modules yet, so its test is run by the `check_module` target
+/// instead of the `check` target.
+/// 
+/// The `module_cost` target measures the time to compile the same source
+/// files when they include the headers and when they import the module.
+/// 
+/// Example
+/// -------
+/// 
+///     #include <fit/macros.hpp>
+///     import fit;
+/// 
+///     struct sum_f
+///     {
+///         template<class T, class U>
+///         constexpr auto operator()(T x, U y) const FIT_RETURNS(x + y);
+///     };
+/// 
+///     FIT_STATIC_FUNCTION(sum) = fit::partial(sum_f());
+///     assert(sum(1)(2) == 3);
+/// 
+
+#include <fit/detail/function_macros.hpp>
+#include <fit/detail/lambda_macros.hpp>
+#include <fit/detail/lift_macros.hpp>
+#include <fit/detail/returns_macros.hpp>
+
+#endif
@@ -19,6 +19,17 @@
 /// a sequence that can be unpacked with `unpack_adaptor` as well. Also,
 /// `pack_join` can be used to join multiple packs together.
 /// 
+/// When all of the elements have the same arithmetic type, such as
+/// `pack(1, 2, 3)`, they are stored in an array.
+/// 
+/// The `pack_filter`, `pack_transform`, `pack_index_of` and `pack_slice`
+/// functions build a new pack from the elements of a pack. The indices of
+/// the elements that are kept are computed first, by constant evaluation,
+/// and then the result is built in a single step, instead of building a
+/// pack for each element and joining them. Like `pack_join`, the elements
+/// are moved when the pack is an rvalue, and references are kept as
+/// references.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -38,6 +49,23 @@
 ///     template<class... Ts>
 ///     constexpr auto pack_join(Ts&&... xs);
 /// 
+///     // Keep the elements whose decayed type satisfies the predicate
+///     template<template<class> class Predicate, class Pack>
+///     constexpr auto pack_filter(Pack&& p);
+/// 
+///     // Call the function with each element
+///     template<class Pack, class F>
+///     constexpr auto pack_transform(Pack&& p, const F& f);
+/// 
+///     // The index of the first element whose decayed type is T, or the
+///     // size of the pack when there is none
+///     template<class T, class Pack>
+///     constexpr std::integral_constant<std::size_t, I> pack_index_of(const Pack& p);
+/// 
+///     // The elements from B to E, not including E
+///     template<std::size_t B, std::size_t E, class Pack>
+///     constexpr auto pack_slice(Pack&& p);
+/// 
 /// Semantics
 /// ---------
 /// 
@@ -45,6 +73,8 @@
 ///     assert(unpack(f)(pack(xs...)) == f(xs...));
 /// 
 ///     assert(pack_join(pack(xs...), pack(ys...)) == pack(xs..., ys...));
+///     assert(pack_transform(pack(xs...), f) == pack(f(xs)...));
+///     assert(pack_slice<1, 3>(pack(x0, x1, x2, x3)) == pack(x1, x2));
 /// 
 /// 
 /// Example
@@ -64,6 +94,7 @@
 /// 
 
 #include <fit/detail/seq.hpp>
+#include <fit/detail/and.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/remove_rvalue_reference.hpp>
 #include <fit/detail/unwrap.hpp>
@@ -247,15 +278,71 @@ struct pack_base<seq<0>, T>
 
 #else
 
+template<class Seq, class... Ts>
+struct pack_holders;
+
 template<std::size_t... Ns, class... Ts>
-struct pack_base<seq<Ns...>, Ts...>
+struct pack_holders<seq<Ns...>, Ts...>
 : pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type...
 {
+    FIT_INHERIT_DEFAULT(pack_holders, Ts...);
+
+    template<class... Xs>
+    constexpr pack_holders(Xs&&... xs) : pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type(fit::forward<Xs>(xs))...
+    {}
+};
+
+// When every element has the same arithmetic type, they are stored in an
+// array instead of a base class for each element
+template<class T, std::size_t N>
+struct pack_array
+{
+    T data[N];
+
+    constexpr pack_array() : data()
+    {}
+
+    template<class... Xs>
+    constexpr pack_array(Xs&&... xs) : data{ T(fit::forward<Xs>(xs))... }
+    {}
+};
+
+template<class Tag>
+struct pack_tag_index;
+
+template<std::size_t N, class... Ts>
+struct pack_tag_index<pack_tag<seq<N>, Ts...>>
+: std::integral_constant<std::size_t, N>
+{};
+
+template<class T, class... Ts>
+struct pack_storage
+: std::conditional<(
+    std::is_arithmetic<T>::value && 
+    and_<std::is_same<T, Ts>...>::value
+),
+    pack_array<T, sizeof...(Ts) + 1>,
+    pack_holders<typename gens<sizeof...(Ts) + 1>::type, T, Ts...>
+>
+{};
+
+// Found by argument dependent lookup
+#define FIT_DETAIL_PACK_ARRAY_VALUE(ref, move) \
+template<class Tag, class T, std::size_t N, class... Ts> \
+constexpr auto alias_value(pack_array<T, N> ref a, Ts&&...) \
+FIT_RETURNS(move(a.data[pack_tag_index<Tag>::value]))
+FIT_UNARY_PERFECT_FOREACH(FIT_DETAIL_PACK_ARRAY_VALUE)
+
+template<std::size_t... Ns, class... Ts>
+struct pack_base<seq<Ns...>, Ts...>
+: pack_storage<Ts...>::type
+{
+    typedef typename pack_storage<Ts...>::type base;
     // FIT_INHERIT_DEFAULT(pack_base, typename std::remove_cv<typename std::remove_reference<Ts>::type>::type...);
     FIT_INHERIT_DEFAULT(pack_base, Ts...);
     
     template<class... Xs, FIT_ENABLE_IF_CONVERTIBLE_UNPACK(Xs&&, typename pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type)>
-    constexpr pack_base(Xs&&... xs) : pack_holder<Ts, pack_tag<seq<Ns>, Ts...>>::type(fit::forward<Xs>(xs))...
+    constexpr pack_base(Xs&&... xs) : base(fit::forward<Xs>(xs)...)
     {}
   
     template<class F>
@@ -295,6 +382,44 @@ constexpr auto unpack_pack_base(F&& f, pack_base<seq<Ns...>, Ts...> ref x) \
 FIT_RETURNS(f(alias_value<pack_tag<seq<Ns>, Ts...>, Ts>(move(x), f)...))
 FIT_UNARY_PERFECT_FOREACH(FIT_DETAIL_UNPACK_PACK_BASE)
 
+// Calls the function with the elements of the pack followed by the
+// arguments, without joining them into another pack first
+struct pack_invoke
+{
+    template<class F, std::size_t... Ns, class... Ts, class... Us>
+    constexpr auto operator()(F&& f, const pack_base<seq<Ns...>, Ts...>& p, Us&&... xs) const FIT_RETURNS
+    (
+        f(pack_get<Ts, pack_tag<seq<Ns>, Ts...>>(p, f)..., fit::forward<Us>(xs)...)
+    );
+};
+
+// Moves the elements out of the pack, except for references, which are
+// passed as they are stored
+template<class T, class Tag, class P, typename std::enable_if<
+    std::is_lvalue_reference<T>::value
+, int>::type = 0>
+constexpr auto pack_move_get(P& p) FIT_RETURNS
+(
+    alias_value<Tag, T>(p)
+);
+
+template<class T, class Tag, class P, typename std::enable_if<
+    !std::is_lvalue_reference<T>::value
+, int>::type = 0>
+constexpr auto pack_move_get(P& p) FIT_RETURNS
+(
+    alias_value<Tag, T>(fit::move(p))
+);
+
+struct pack_move_invoke
+{
+    template<class F, std::size_t... Ns, class... Ts, class... Us>
+    constexpr auto operator()(F&& f, pack_base<seq<Ns...>, Ts...>& p, Us&&... xs) const FIT_RETURNS
+    (
+        f(pack_move_get<Ts, pack_tag<seq<Ns>, Ts...>>(p)..., fit::forward<Us>(xs)...)
+    );
+};
+
 template<class P1, class P2>
 struct pack_join_base;
 
@@ -394,6 +519,146 @@ struct pack_join_f
     );
 };
 
+template<class P>
+struct pack_remove_cvref
+: std::remove_cv<typename std::remove_reference<P>::type>
+{};
+
+// The type of an element is found by overload resolution on its base,
+// instead of recursing over the elements before it
+template<std::size_t N, class T>
+struct pack_element_leaf
+{};
+
+template<class T>
+struct pack_element_type
+{
+    typedef T type;
+};
+
+template<class Seq, class... Ts>
+struct pack_element_leaves;
+
+template<std::size_t... Ns, class... Ts>
+struct pack_element_leaves<seq<Ns...>, Ts...>
+: pack_element_leaf<Ns, Ts>...
+{};
+
+template<std::size_t N, class T>
+pack_element_type<T> pack_element_lookup(const pack_element_leaf<N, T>&);
+
+template<std::size_t N, class Leaves>
+struct pack_element
+: decltype(pack_element_lookup<N>(std::declval<Leaves>()))
+{};
+
+// Builds a pack of the elements at the indices in Seq in a single step
+template<class Seq, class P>
+struct pack_select;
+
+template<std::size_t... Is, std::size_t... Ns, class... Ts>
+struct pack_select<seq<Is...>, pack_base<seq<Ns...>, Ts...>>
+{
+    typedef pack_element_leaves<seq<Ns...>, Ts...> leaves;
+    typedef pack_base<typename gens<sizeof...(Is)>::type, typename pack_element<Is, leaves>::type...> result_type;
+
+    template<class P>
+    static constexpr result_type call(P&& p)
+    {
+        return result_type(pack_get<typename pack_element<Is, leaves>::type, pack_tag<seq<Is>, Ts...>>(fit::forward<P>(p))...);
+    }
+};
+
+constexpr std::size_t pack_count_true()
+{
+    return 0;
+}
+
+template<class... Bs>
+constexpr std::size_t pack_count_true(bool b, Bs... bs)
+{
+    return (b ? 1 : 0) + pack_count_true(bs...);
+}
+
+// The index of the k-th true value, or the number of values when there are
+// not enough true values
+constexpr std::size_t pack_nth_true(std::size_t, std::size_t i)
+{
+    return i;
+}
+
+template<class... Bs>
+constexpr std::size_t pack_nth_true(std::size_t k, std::size_t i, bool b, Bs... bs)
+{
+    return b && k == 0 ? i : pack_nth_true(b ? k - 1 : k, i + 1, bs...);
+}
+
+template<class Seq, bool... Bs>
+struct pack_true_indices;
+
+template<std::size_t... Ks, bool... Bs>
+struct pack_true_indices<seq<Ks...>, Bs...>
+{
+    typedef seq<pack_nth_true(Ks, 0, Bs...)...> type;
+};
+
+template<template<class> class Predicate, class P>
+struct pack_filter_result;
+
+template<template<class> class Predicate, std::size_t... Ns, class... Ts>
+struct pack_filter_result<Predicate, pack_base<seq<Ns...>, Ts...>>
+: pack_select<typename pack_true_indices<
+    typename gens<pack_count_true(Predicate<typename std::decay<Ts>::type>::value...)>::type,
+    Predicate<typename std::decay<Ts>::type>::value...
+>::type, pack_base<seq<Ns...>, Ts...>>
+{};
+
+template<class T, class P>
+struct pack_index_of_result;
+
+template<class T, std::size_t... Ns, class... Ts>
+struct pack_index_of_result<T, pack_base<seq<Ns...>, Ts...>>
+: std::integral_constant<std::size_t, pack_nth_true(0, 0, std::is_same<T, typename std::decay<Ts>::type>::value...)>
+{};
+
+template<std::size_t B, class Seq>
+struct pack_offset_seq;
+
+template<std::size_t B, std::size_t... Ns>
+struct pack_offset_seq<B, seq<Ns...>>
+{
+    typedef seq<(B + Ns)...> type;
+};
+
+template<std::size_t B, std::size_t E, class P>
+struct pack_slice_result
+: pack_select<typename pack_offset_seq<B, typename gens<E - B>::type>::type, P>
+{
+    static_assert(B <= E, "The beginning of the slice is after its end");
+    static_assert(E <= P::fit_function_param_limit::value, "The end of the slice is past the end of the pack");
+};
+
+template<class F>
+struct pack_transform_invoke
+{
+    const F& f;
+
+    template<class... Ts>
+    constexpr auto operator()(Ts&&... xs) const FIT_RETURNS
+    (
+        pack_f()(f(fit::forward<Ts>(xs))...)
+    );
+};
+
+struct pack_transform_f
+{
+    template<class P, class F>
+    constexpr auto operator()(P&& p, const F& f) const FIT_RETURNS
+    (
+        unpack_pack_base(pack_transform_invoke<F>{ f }, fit::forward<P>(p))
+    );
+};
+
 }
 
 FIT_DECLARE_STATIC_VAR(pack, detail::pack_f);
@@ -402,6 +667,28 @@ FIT_DECLARE_STATIC_VAR(pack_decay, detail::pack_decay_f);
 
 FIT_DECLARE_STATIC_VAR(pack_join, detail::pack_join_f);
 
+FIT_DECLARE_STATIC_VAR(pack_transform, detail::pack_transform_f);
+
+template<template<class> class Predicate, class P>
+constexpr typename detail::pack_filter_result<Predicate, typename detail::pack_remove_cvref<P>::type>::result_type
+pack_filter(P&& p)
+{
+    return detail::pack_filter_result<Predicate, typename detail::pack_remove_cvref<P>::type>::call(fit::forward<P>(p));
+}
+
+template<std::size_t B, std::size_t E, class P>
+constexpr typename detail::pack_slice_result<B, E, typename detail::pack_remove_cvref<P>::type>::result_type
+pack_slice(P&& p)
+{
+    return detail::pack_slice_result<B, E, typename detail::pack_remove_cvref<P>::type>::call(fit::forward<P>(p));
+}
+
+template<class T, class P>
+constexpr detail::pack_index_of_result<T, typename detail::pack_remove_cvref<P>::type> pack_index_of(const P&)
+{
+    return {};
+}
+
 } // namespace fit
 
 #endif
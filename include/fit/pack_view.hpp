@@ -0,0 +1,258 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    pack_view.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_PACK_VIEW_H
+#define FIT_GUARD_PACK_VIEW_H
+
+/// pack_view
+/// =========
+/// 
+/// Description
+/// -----------
+/// 
+/// The `pack_write` function writes the elements of a sequence, such as a
+/// [`pack`](pack.md) or a `std::tuple`, to a buffer of bytes, and the
+/// `pack_view` function reads them back from the buffer. The view doesn't
+/// copy the record. It is a sequence that can be used with
+/// [`unpack`](unpack.md), and each element is read from the buffer when the
+/// sequence is unpacked, so a function can be called with the records of a
+/// memory mapped file without deserializing them first.
+/// 
+/// The layout of a record is described by `pack_layout`. The elements are
+/// stored in order, each one at the first offset after the previous element
+/// that is a multiple of its alignment, like the members of a struct. The
+/// size of the record is rounded up to the largest alignment of the
+/// elements, so records can be stored one after the other. The bytes of an
+/// element are its object representation, so the byte order is the one of
+/// the platform, and the padding bytes are written as zeros.
+/// 
+/// The elements are read with `std::memcpy`, so the buffer doesn't have to
+/// be aligned, although reading is usually faster when the buffer is aligned
+/// to `pack_layout<Ts...>::alignment()`.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class... Ts>
+///     struct pack_layout
+///     {
+///         static constexpr std::size_t size();
+///         static constexpr std::size_t alignment();
+///         static constexpr std::size_t offset(std::size_t i);
+///     };
+/// 
+///     template<class Sequence>
+///     unsigned char* pack_write(unsigned char* buffer, Sequence&& s);
+/// 
+///     template<class... Ts>
+///     constexpr pack_view_sequence<Ts...> pack_view(const unsigned char* buffer);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     pack_write(buffer, pack(xs...));
+///     assert(unpack(f)(pack_view<Ts...>(buffer)) == f(xs...));
+/// 
+/// Requirements
+/// ------------
+/// 
+/// The decayed type of each element must be TriviallyCopyable, and the
+/// buffer must have at least `pack_layout<Ts...>::size()` bytes. The types
+/// given to `pack_view` must be the decayed types of the elements that were
+/// written.
+/// 
+/// Example
+/// -------
+/// 
+///     struct sum_f
+///     {
+///         double operator()(int x, double y) const
+///         {
+///             return x + y;
+///         }
+///     };
+/// 
+///     typedef fit::pack_layout<int, double> layout;
+///     std::vector<unsigned char> buffer(3 * layout::size());
+///     unsigned char* out = buffer.data();
+///     for(int i=0;i<3;i++) out = fit::pack_write(out, fit::pack(i, 0.5));
+/// 
+///     double sum = 0;
+///     for(std::size_t i=0;i<3;i++)
+///         sum += fit::unpack(sum_f())(fit::pack_view<int, double>(buffer.data() + i * layout::size()));
+///     assert(sum == 4.5);
+/// 
+
+#include <fit/pack.hpp>
+#include <fit/unpack.hpp>
+#include <fit/detail/and.hpp>
+#include <fit/detail/seq.hpp>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace fit { namespace detail {
+
+template<class T>
+struct pack_view_is_trivially_copyable
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 5
+: std::integral_constant<bool, __has_trivial_copy(T) && __has_trivial_destructor(T)>
+#else
+: std::is_trivially_copyable<T>
+#endif
+{};
+
+struct pack_field_layout
+{
+    std::size_t size;
+    std::size_t align;
+};
+
+constexpr std::size_t pack_align_up(std::size_t n, std::size_t a)
+{
+    return (n + a - 1) / a * a;
+}
+
+// The offset of the i-th field, or the end of the last field when i is the
+// number of fields
+constexpr std::size_t pack_layout_offset(std::size_t, std::size_t offset)
+{
+    return offset;
+}
+
+template<class... Fs>
+constexpr std::size_t pack_layout_offset(std::size_t i, std::size_t offset, pack_field_layout f, Fs... fs)
+{
+    return i == 0 ?
+        pack_align_up(offset, f.align) :
+        pack_layout_offset(i - 1, pack_align_up(offset, f.align) + f.size, fs...);
+}
+
+constexpr std::size_t pack_layout_alignment(std::size_t a)
+{
+    return a;
+}
+
+template<class... Fs>
+constexpr std::size_t pack_layout_alignment(std::size_t a, pack_field_layout f, Fs... fs)
+{
+    return pack_layout_alignment(a < f.align ? f.align : a, fs...);
+}
+
+}
+
+template<class... Ts>
+struct pack_layout
+{
+    static_assert(detail::and_<detail::pack_view_is_trivially_copyable<Ts>...>::value, "The elements must be trivially copyable");
+
+    static constexpr std::size_t alignment()
+    {
+        return detail::pack_layout_alignment(1, detail::pack_field_layout{ sizeof(Ts), alignof(Ts) }...);
+    }
+
+    static constexpr std::size_t offset(std::size_t i)
+    {
+        return detail::pack_layout_offset(i, 0, detail::pack_field_layout{ sizeof(Ts), alignof(Ts) }...);
+    }
+
+    static constexpr std::size_t size()
+    {
+        return detail::pack_align_up(offset(sizeof...(Ts)), alignment());
+    }
+};
+
+template<class... Ts>
+struct pack_view_sequence
+{
+    typedef pack_layout<Ts...> layout;
+    typedef detail::pack_element_leaves<typename detail::gens<sizeof...(Ts)>::type, Ts...> leaves;
+
+    const unsigned char* data;
+
+    constexpr pack_view_sequence(const unsigned char* p) : data(p)
+    {}
+
+    template<std::size_t I>
+    typename detail::pack_element<I, leaves>::type get() const
+    {
+        typedef typename detail::pack_element<I, leaves>::type T;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type x;
+        std::memcpy(&x, data + layout::offset(I), sizeof(T));
+        return *reinterpret_cast<const T*>(&x);
+    }
+};
+
+template<class... Ts>
+constexpr pack_view_sequence<Ts...> pack_view(const unsigned char* buffer)
+{
+    return pack_view_sequence<Ts...>(buffer);
+}
+
+namespace detail {
+
+template<class Seq>
+struct pack_view_unpack;
+
+template<std::size_t... Ns>
+struct pack_view_unpack<seq<Ns...>>
+{
+    template<class F, class S>
+    static auto apply(F&& f, const S& s) FIT_RETURNS
+    (
+        f(s.template get<Ns>()...)
+    );
+};
+
+struct pack_writer
+{
+    unsigned char* out;
+
+    template<class T>
+    static void write_field(unsigned char* out, const T& x)
+    {
+        std::memcpy(out, std::addressof(x), sizeof(T));
+    }
+
+    template<std::size_t... Ns, class... Ts>
+    unsigned char* write(seq<Ns...>, const Ts&... xs) const
+    {
+        typedef pack_layout<typename std::decay<Ts>::type...> layout;
+        std::memset(out, 0, layout::size());
+        int x[] = { 0, (write_field(out + layout::offset(Ns), xs), 0)... };
+        (void)x;
+        return out + layout::size();
+    }
+
+    template<class... Ts>
+    unsigned char* operator()(const Ts&... xs) const
+    {
+        return this->write(typename gens<sizeof...(Ts)>::type(), xs...);
+    }
+};
+
+}
+
+template<class... Ts>
+struct unpack_sequence<pack_view_sequence<Ts...>>
+{
+    template<class F, class S>
+    static auto apply(F&& f, S&& s) FIT_RETURNS
+    (
+        detail::pack_view_unpack<typename detail::gens<sizeof...(Ts)>::type>::apply(fit::forward<F>(f), s)
+    );
+};
+
+template<class Sequence>
+unsigned char* pack_write(unsigned char* buffer, Sequence&& s)
+{
+    return unpack(detail::pack_writer{ buffer })(fit::forward<Sequence>(s));
+}
+
+} // namespace fit
+
+#endif
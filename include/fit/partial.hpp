@@ -21,6 +21,12 @@
 /// value, just like bind. `std::ref` can be used to capture references
 /// instead.
 /// 
+/// When the partially applied function is an rvalue, such as in
+/// `partial(f)(x)(y)(z)`, the function and the bound arguments are moved into
+/// the next partial function, or into the call, instead of being copied. This
+/// needs C++14 `constexpr`, and can be disabled by defining
+/// `FIT_PARTIAL_HAS_RVALUE_THIS` to 0.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -55,20 +61,25 @@
 ///     assert(3 == partial(sum())(1)(2));
 /// 
 
+#include <fit/fwd.hpp>
 #include <fit/conditional.hpp>
 #include <fit/static.hpp>
 #include <fit/pipable.hpp>
 #include <fit/detail/make.hpp>
 #include <fit/detail/static_const_var.hpp>
+#include <fit/detail/static_constexpr.hpp>
 
+#ifndef FIT_PARTIAL_HAS_RVALUE_THIS
+#if FIT_HAS_RELAXED_CONSTEXPR || (defined(__cpp_constexpr) && __cpp_constexpr >= 201304L)
+#define FIT_PARTIAL_HAS_RVALUE_THIS 1
+#else
+#define FIT_PARTIAL_HAS_RVALUE_THIS 0
+#endif
+#endif
 
 namespace fit { 
 
 // TODO: Get rid of sequence parameter
-// Forward declare partial_adaptor, since it will be used below
-template<class F, class Pack=void >
-struct partial_adaptor;
-
 FIT_DECLARE_STATIC_VAR(partial, detail::make<partial_adaptor>);
 
 namespace detail {
@@ -91,22 +102,15 @@ struct partial_adaptor_invoke
     FIT_RETURNS_CLASS(partial_adaptor_invoke);
 
     template<class... Ts>
-    constexpr FIT_SFINAE_RESULT
-    (
-        typename result_of<decltype(fit::pack_join), 
-            id_<const Pack&>, 
-            result_of<decltype(fit::pack_forward), id_<Ts>...> 
-        >::type,
-        id_<F&&>
-    ) 
+    constexpr FIT_SFINAE_RESULT(pack_invoke, id_<F&&>, id_<const Pack&>, id_<Ts>...)
     operator()(Ts&&... xs) const FIT_SFINAE_RETURNS
     (
-        fit::pack_join
+        pack_invoke()
         (
+            FIT_RETURNS_C_CAST(F&&)(FIT_CONST_THIS->get_function(xs...)),
             FIT_MANGLE_CAST(const Pack&)(FIT_CONST_THIS->get_pack(xs...)), 
-            fit::pack_forward(fit::forward<Ts>(xs)...)
+            fit::forward<Ts>(xs)...
         )
-        (FIT_RETURNS_C_CAST(F&&)(FIT_CONST_THIS->get_function(xs...)))
     );
 };
 
@@ -131,7 +135,7 @@ struct partial_adaptor_join
     template<class... Ts, class=typename std::enable_if<
         (sizeof...(Ts) + Pack::fit_function_param_limit::value) < function_param_limit<F>::value
     >::type>
-    constexpr auto operator()(Ts&&... xs) const FIT_SFINAE_RETURNS
+    constexpr auto operator()(Ts&&... xs) const FIT_RETURNS
     (
         partial
         (
@@ -158,7 +162,7 @@ struct partial_adaptor_pack
     template<class... Ts, class=typename std::enable_if<
         sizeof...(Ts) < function_param_limit<F>::value
     >::type>
-    constexpr auto operator()(Ts&&... xs) const FIT_SFINAE_RETURNS
+    constexpr auto operator()(Ts&&... xs) const FIT_RETURNS
     (
         partial
         (
@@ -167,6 +171,34 @@ struct partial_adaptor_pack
         )
     );
 };
+#if FIT_PARTIAL_HAS_RVALUE_THIS
+// Used when the partial adaptor is an rvalue, so the function and the
+// bound arguments are moved instead of copied
+struct partial_adaptor_move_invoke
+{
+    template<class F, class Pack, class... Ts>
+    constexpr auto operator()(F&& f, Pack& p, Ts&&... xs) const FIT_RETURNS
+    (
+        pack_move_invoke()(fit::forward<F>(f), p, fit::forward<Ts>(xs)...)
+    );
+};
+
+struct partial_adaptor_move_join
+{
+    template<class F, class Pack, class... Ts, class=typename std::enable_if<
+        (sizeof...(Ts) + Pack::fit_function_param_limit::value) < function_param_limit<F>::value
+    >::type>
+    constexpr auto operator()(F&& f, Pack& p, Ts&&... xs) const FIT_RETURNS
+    (
+        partial
+        (
+            fit::forward<F>(f), 
+            fit::pack_join(fit::move(p), fit::pack_decay(fit::forward<Ts>(xs)...))
+        )
+    );
+};
+#endif
+
 template<class F, class Pack>
 struct partial_adaptor_base 
 {
@@ -209,6 +241,19 @@ struct partial_adaptor : detail::partial_adaptor_base<F, Pack>::type, F, Pack
 
     using base::operator();
 
+#if FIT_PARTIAL_HAS_RVALUE_THIS
+    template<class... Ts>
+    constexpr auto operator()(Ts&&... xs) && FIT_RETURNS
+    (
+        conditional_adaptor<detail::partial_adaptor_move_invoke, detail::partial_adaptor_move_join>()
+        (
+            static_cast<F&&>(*this), 
+            static_cast<Pack&>(*this), 
+            fit::forward<Ts>(xs)...
+        )
+    );
+#endif
+
     constexpr partial_adaptor()
     {}
 
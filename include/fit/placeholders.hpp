@@ -45,6 +45,10 @@
 ///     auto sum = _1 + _2;
 ///     assert(3 == sum(1, 2));
 /// 
+/// Expressions built from the operators can be combined further, such as
+/// `_1 * _2 + _3 * _4`. The whole expression is evaluated directly with the
+/// arguments it is called with, without building any intermediate packs.
+/// 
 /// 
 /// unamed placeholder
 /// ==================
@@ -171,33 +175,189 @@ FIT_FOREACH_UNARY_OP(FIT_UNARY_OP)
 
 }
 
+template<int N>
+struct placeholder;
+
+template<class Op, class... Ts>
+struct placeholder_expression;
+
+namespace detail {
+
+template<class T>
+struct placeholder_category
+: std::integral_constant<int, 
+    (std::is_placeholder<T>::value > 0) ? 0 :
+    std::is_bind_expression<T>::value ? 1 :
+    is_reference_wrapper<T>::value ? 2 : 3
+>
+{};
+
+template<class T, class... Ts>
+constexpr auto placeholder_eval(std::integral_constant<int, 0>, const T&, Ts&&... xs) FIT_RETURNS
+(detail::get_args<std::is_placeholder<T>::value>(fit::forward<Ts>(xs)...));
+
+template<class T, class... Ts>
+constexpr auto placeholder_eval(std::integral_constant<int, 1>, const T& x, Ts&&... xs) FIT_RETURNS
+(x(fit::forward<Ts>(xs)...));
+
+template<class T, class... Ts>
+constexpr T& placeholder_eval(std::integral_constant<int, 2>, const std::reference_wrapper<T>& x, Ts&&...)
+{
+    return x.get();
+}
+
+template<class T, class... Ts>
+constexpr const T& placeholder_eval(std::integral_constant<int, 3>, const T& x, Ts&&...)
+{
+    return x;
+}
+
+template<std::size_t I, class T>
+struct placeholder_operand
+{
+    T value;
+    FIT_DELGATE_CONSTRUCTOR(placeholder_operand, T, value);
+};
+
+template<std::size_t I, int N>
+struct placeholder_operand<I, simple_placeholder<N>>
+{
+    simple_placeholder<N> value;
+
+    constexpr placeholder_operand() : value()
+    {}
+
+    constexpr placeholder_operand(const simple_placeholder<N>&) : value()
+    {}
+
+    constexpr placeholder_operand(const placeholder<N>&) : value()
+    {}
+};
+
+template<std::size_t I, class T, class... Ts>
+constexpr const T& placeholder_operand_value(const placeholder_operand<I, T>& x, Ts&&...)
+{
+    return x.value;
+}
+
+template<class T>
+struct placeholder_operand_type_impl
+{
+    typedef T type;
+};
+
+template<int N>
+struct placeholder_operand_type_impl<placeholder<N>>
+{
+    typedef simple_placeholder<N> type;
+};
+
+template<class T>
+struct placeholder_operand_type
+: placeholder_operand_type_impl<typename std::decay<T>::type>
+{};
+
+template<class T>
+struct is_placeholder_operand_impl
+: std::false_type
+{};
+
+template<int N>
+struct is_placeholder_operand_impl<placeholder<N>>
+: std::true_type
+{};
+
+template<class Op, class... Ts>
+struct is_placeholder_operand_impl<placeholder_expression<Op, Ts...>>
+: std::true_type
+{};
+
+template<class T>
+struct is_placeholder_operand
+: is_placeholder_operand_impl<typename std::decay<T>::type>
+{};
+
+// Each operand is evaluated directly with the arguments passed to the
+// expression, so no intermediate packs are built while evaluating
+template<class Op, class Seq, class... Ts>
+struct placeholder_expression_base;
+
+template<class Op, std::size_t... Ns, class... Ts>
+struct placeholder_expression_base<Op, seq<Ns...>, Ts...>
+: placeholder_operand<Ns, Ts>...
+{
+    FIT_INHERIT_DEFAULT(placeholder_expression_base, placeholder_operand<Ns, Ts>...)
+
+    template<class... Xs, FIT_ENABLE_IF_CONVERTIBLE_UNPACK(Xs&&, placeholder_operand<Ns, Ts>)>
+    constexpr placeholder_expression_base(Xs&&... xs) : placeholder_operand<Ns, Ts>(fit::forward<Xs>(xs))...
+    {}
+
+    FIT_RETURNS_CLASS(placeholder_expression_base);
+
+    template<class... Xs>
+    constexpr auto operator()(Xs&&... xs) const FIT_RETURNS
+    (
+        Op()(detail::placeholder_eval(
+            placeholder_category<Ts>(),
+            detail::placeholder_operand_value<Ns>(*FIT_CONST_THIS, xs...),
+            fit::forward<Xs>(xs)...
+        )...)
+    );
+};
+
+template<class Op, class... Ts>
+constexpr placeholder_expression<Op, typename placeholder_operand_type<Ts>::type...> 
+make_placeholder_expression(Ts&&... xs)
+{
+    return placeholder_expression<Op, typename placeholder_operand_type<Ts>::type...>(fit::forward<Ts>(xs)...);
+}
+
+}
+
+template<class Op, class... Ts>
+struct placeholder_expression
+: detail::placeholder_expression_base<Op, typename detail::gens<sizeof...(Ts)>::type, Ts...>
+{
+    typedef detail::placeholder_expression_base<Op, typename detail::gens<sizeof...(Ts)>::type, Ts...> base;
+
+    FIT_INHERIT_CONSTRUCTOR(placeholder_expression, base);
+
+    FIT_RETURNS_CLASS(placeholder_expression);
+
+#define FIT_PLACEHOLDER_EXPRESSION_UNARY_OP(op, name) \
+    constexpr auto operator op () const FIT_RETURNS \
+    ( detail::make_placeholder_expression<operators::name>(*FIT_CONST_THIS) );
+
+FIT_FOREACH_UNARY_OP(FIT_PLACEHOLDER_EXPRESSION_UNARY_OP)
+};
+
 template<int N>
 struct placeholder
 {
 #if FIT_HAS_MANGLE_OVERLOAD
     template<class... Ts>
     constexpr auto operator()(Ts&&... xs) const FIT_RETURNS 
-    ( fit::lazy(operators::call())(detail::simple_placeholder<N>(), fit::forward<Ts>(xs)...) );
+    ( detail::make_placeholder_expression<operators::call>(detail::simple_placeholder<N>(), fit::forward<Ts>(xs)...) );
 #else
     template<class... Ts>
     struct result_call
-    { typedef decltype(fit::lazy(operators::call())(detail::simple_placeholder<N>(), std::declval<Ts>()...)) type; };
+    { typedef decltype(detail::make_placeholder_expression<operators::call>(detail::simple_placeholder<N>(), std::declval<Ts>()...)) type; };
     template<class... Ts>
     constexpr typename result_call<Ts...>::type operator()(Ts&&... xs) const 
-    { return fit::lazy(operators::call())(detail::simple_placeholder<N>(), fit::forward<Ts>(xs)...); };
+    { return detail::make_placeholder_expression<operators::call>(detail::simple_placeholder<N>(), fit::forward<Ts>(xs)...); };
 
 #endif
 
 #define FIT_PLACEHOLDER_UNARY_OP(op, name) \
     constexpr auto operator op () const FIT_RETURNS \
-    ( fit::lazy(operators::name())(detail::simple_placeholder<N>()) );
+    ( detail::make_placeholder_expression<operators::name>(detail::simple_placeholder<N>()) );
 
 FIT_FOREACH_UNARY_OP(FIT_PLACEHOLDER_UNARY_OP)
 
 #define FIT_PLACEHOLDER_ASSIGN_OP(op, name) \
     template<class T> \
     constexpr auto operator op (T&& x) const FIT_RETURNS \
-    ( fit::lazy(operators::name())(detail::simple_placeholder<N>(), fit::forward<T>(x)) );
+    ( detail::make_placeholder_expression<operators::name>(detail::simple_placeholder<N>(), fit::forward<T>(x)) );
 
 FIT_FOREACH_ASSIGN_OP(FIT_PLACEHOLDER_ASSIGN_OP)
 
@@ -206,31 +366,23 @@ FIT_FOREACH_ASSIGN_OP(FIT_PLACEHOLDER_ASSIGN_OP)
 #if FIT_HAS_MANGLE_OVERLOAD
 
 #define FIT_PLACEHOLDER_BINARY_OP(op, name) \
-    template<class T, int N> \
-    constexpr inline auto operator op (const placeholder<N>&, T&& x) FIT_RETURNS \
-    ( fit::lazy(operators::name())(detail::simple_placeholder<N>(), fit::forward<T>(x)) ); \
-    template<class T, int N> \
-    constexpr inline auto operator op (T&& x, const placeholder<N>&) FIT_RETURNS \
-    ( fit::lazy(operators::name())(fit::forward<T>(x), detail::simple_placeholder<N>()) ); \
-    template<int N, int M> \
-    constexpr inline auto operator op (const placeholder<N>&, const placeholder<M>&) FIT_RETURNS \
-    ( fit::lazy(operators::name())(detail::simple_placeholder<N>(), detail::simple_placeholder<M>()) );
+    template<class T, class U, class=typename std::enable_if<( \
+        detail::is_placeholder_operand<T>::value || detail::is_placeholder_operand<U>::value \
+    )>::type> \
+    constexpr inline auto operator op (T&& x, U&& y) FIT_RETURNS \
+    ( detail::make_placeholder_expression<operators::name>(fit::forward<T>(x), fit::forward<U>(y)) );
 
 #else
 
 #define FIT_PLACEHOLDER_BINARY_OP(op, name) \
     template<class T, class U> \
     struct result_ ## name \
-    { typedef decltype(fit::lazy(operators::name())(std::declval<T>(), std::declval<U>())) type; }; \
-    template<class T, int N> \
-    constexpr inline typename result_ ## name<detail::simple_placeholder<N>, T>::type operator op (const placeholder<N>&, T&& x) \
-    { return fit::lazy(operators::name())(detail::simple_placeholder<N>(), fit::forward<T>(x)); } \
-    template<class T, int N> \
-    constexpr inline typename result_ ## name<T, detail::simple_placeholder<N>>::type operator op (T&& x, const placeholder<N>&) \
-    { return fit::lazy(operators::name())(fit::forward<T>(x), detail::simple_placeholder<N>()); } \
-    template<int N, int M> \
-    constexpr inline typename result_ ## name<detail::simple_placeholder<N>, detail::simple_placeholder<M>>::type operator op (const placeholder<N>&, const placeholder<M>&) \
-    { return fit::lazy(operators::name())(detail::simple_placeholder<N>(), detail::simple_placeholder<M>()); }
+    { typedef decltype(detail::make_placeholder_expression<operators::name>(std::declval<T>(), std::declval<U>())) type; }; \
+    template<class T, class U, class=typename std::enable_if<( \
+        detail::is_placeholder_operand<T>::value || detail::is_placeholder_operand<U>::value \
+    )>::type> \
+    constexpr inline typename result_ ## name<T, U>::type operator op (T&& x, U&& y) \
+    { return detail::make_placeholder_expression<operators::name>(fit::forward<T>(x), fit::forward<U>(y)); }
 
 #endif
 
@@ -322,6 +474,11 @@ namespace std {
     struct is_placeholder<fit::placeholder<N>>
     : std::integral_constant<int, N>
     {};
+
+    template<class Op, class... Ts>
+    struct is_bind_expression<fit::placeholder_expression<Op, Ts...>>
+    : std::true_type
+    {};
 }
 
 #endif
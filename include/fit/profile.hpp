@@ -0,0 +1,393 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    profile.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_PROFILE_H
+#define FIT_GUARD_PROFILE_H
+
+/// profile
+/// =======
+/// 
+/// Description
+/// -----------
+/// 
+/// The `profile` function adaptor records every call to the function under
+/// the name given. For each name, it records the number of calls, the total,
+/// minimum and maximum latency, and a histogram of the latencies, where
+/// bucket `i` counts the calls that took from `2^i` up to `2^(i+1)`
+/// nanoseconds.
+/// 
+/// The counters are kept per thread, so recording a call never waits on
+/// another thread. They are added together when `profile_snapshot` is
+/// called, which can be written out as text or JSON with `profile_write` or
+/// `profile_dump`.
+/// 
+/// When no name is given, the name of the type of the function is used.
+/// Since [`FIT_STATIC_FUNCTION`](function.md) default constructs the
+/// function, the name of the type is used for those functions as well.
+/// 
+/// When `FIT_PROFILE` is defined to 0, nothing is recorded and the adaptor
+/// calls the function directly.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     constexpr profile_adaptor<F> profile(F f);
+/// 
+///     template<class F>
+///     constexpr profile_adaptor<F> profile(F f, const char* name);
+/// 
+///     enum class profile_format { text, json };
+/// 
+///     std::vector<profile_record> profile_snapshot();
+/// 
+///     void profile_reset();
+/// 
+///     void profile_write(std::ostream& os, profile_format format=profile_format::text);
+/// 
+///     bool profile_dump(const char* filename, profile_format format=profile_format::text);
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// The name must be a string that lives for the whole program, such as a
+/// string literal.
+/// 
+/// Example
+/// -------
+/// 
+///     struct sum_f
+///     {
+///         template<class T, class U>
+///         T operator()(T x, U y) const
+///         {
+///             return x+y;
+///         }
+///     };
+/// 
+///     auto sum = fit::profile(sum_f(), "sum");
+///     assert(3 == sum(1, 2));
+///     fit::profile_dump("profile.json", fit::profile_format::json);
+/// 
+
+#ifndef FIT_PROFILE
+#define FIT_PROFILE 1
+#endif
+
+#include <fit/detail/callable_base.hpp>
+#include <fit/detail/named_adaptor.hpp>
+#include <fit/detail/delegate.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fit {
+
+struct profile_record
+{
+    std::string name;
+    std::uint64_t count;
+    std::uint64_t total;
+    std::uint64_t min;
+    std::uint64_t max;
+    std::array<std::uint64_t, 64> histogram;
+
+    profile_record() : name(), count(0), total(0), min(0), max(0), histogram()
+    {}
+};
+
+enum class profile_format
+{
+    text,
+    json
+};
+
+namespace detail {
+
+inline std::size_t profile_bucket(std::uint64_t ns)
+{
+    std::size_t i = 0;
+    while (ns > 1)
+    {
+        ns >>= 1;
+        i++;
+    }
+    return i;
+}
+
+// Only the thread that owns the counters writes to them, so a relaxed load
+// and store is enough, while other threads can still read them to aggregate
+struct profile_counters
+{
+    std::atomic<std::uint64_t> count;
+    std::atomic<std::uint64_t> total;
+    std::atomic<std::uint64_t> min;
+    std::atomic<std::uint64_t> max;
+    std::array<std::atomic<std::uint64_t>, 64> histogram;
+
+    profile_counters()
+    {
+        this->reset();
+    }
+
+    static void add(std::atomic<std::uint64_t>& x, std::uint64_t n)
+    {
+        x.store(x.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    void record(std::uint64_t ns)
+    {
+        add(count, 1);
+        add(total, ns);
+        if (ns < min.load(std::memory_order_relaxed)) min.store(ns, std::memory_order_relaxed);
+        if (ns > max.load(std::memory_order_relaxed)) max.store(ns, std::memory_order_relaxed);
+        add(histogram[profile_bucket(ns)], 1);
+    }
+
+    void reset()
+    {
+        count.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+        min.store(UINT64_MAX, std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+        for (auto& x : histogram) x.store(0, std::memory_order_relaxed);
+    }
+
+    void merge_into(profile_record& r) const
+    {
+        std::uint64_t n = count.load(std::memory_order_relaxed);
+        if (n == 0) return;
+        std::uint64_t lo = min.load(std::memory_order_relaxed);
+        std::uint64_t hi = max.load(std::memory_order_relaxed);
+        r.min = r.count == 0 ? lo : std::min(r.min, lo);
+        r.max = std::max(r.max, hi);
+        r.count += n;
+        r.total += total.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < histogram.size(); i++)
+            r.histogram[i] += histogram[i].load(std::memory_order_relaxed);
+    }
+};
+
+struct profile_thread_table;
+
+struct profile_registry
+{
+    std::mutex m;
+    std::vector<profile_thread_table*> tables;
+    // Counters of the threads that have already exited
+    std::map<std::string, profile_record> retired;
+};
+
+inline profile_registry& get_profile_registry()
+{
+    static profile_registry r;
+    return r;
+}
+
+inline void profile_merge(std::map<std::string, profile_record>& records, const char* name, const profile_counters& c)
+{
+    profile_record& r = records[name];
+    r.name = name;
+    c.merge_into(r);
+}
+
+struct profile_thread_table
+{
+    // Locked by the owning thread only when a new name is added, and by other
+    // threads while aggregating
+    std::mutex m;
+    std::unordered_map<const char*, profile_counters> counters;
+
+    profile_thread_table()
+    {
+        profile_registry& r = get_profile_registry();
+        std::lock_guard<std::mutex> lock(r.m);
+        r.tables.push_back(this);
+    }
+
+    ~profile_thread_table()
+    {
+        profile_registry& r = get_profile_registry();
+        std::lock_guard<std::mutex> lock(r.m);
+        for (auto&& p : counters) profile_merge(r.retired, p.first, p.second);
+        r.tables.erase(std::remove(r.tables.begin(), r.tables.end(), this), r.tables.end());
+    }
+
+    profile_thread_table(const profile_thread_table&) = delete;
+    profile_thread_table& operator=(const profile_thread_table&) = delete;
+
+    profile_counters& get(const char* name)
+    {
+        auto it = counters.find(name);
+        if (it != counters.end()) return it->second;
+        std::lock_guard<std::mutex> lock(m);
+        return counters.emplace(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple()).first->second;
+    }
+};
+
+inline profile_counters& get_profile_counters(const char* name)
+{
+    static thread_local profile_thread_table t;
+    return t.get(name);
+}
+
+struct profile_scope
+{
+    profile_counters& c;
+    std::chrono::steady_clock::time_point start;
+
+    profile_scope(const char* name) : c(get_profile_counters(name)), start(std::chrono::steady_clock::now())
+    {}
+
+    ~profile_scope()
+    {
+        auto d = std::chrono::steady_clock::now() - start;
+        c.record(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+    }
+};
+
+}
+
+inline std::vector<profile_record> profile_snapshot()
+{
+    detail::profile_registry& r = detail::get_profile_registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    std::map<std::string, profile_record> records = r.retired;
+    for (detail::profile_thread_table* t : r.tables)
+    {
+        std::lock_guard<std::mutex> table_lock(t->m);
+        for (auto&& p : t->counters) detail::profile_merge(records, p.first, p.second);
+    }
+    std::vector<profile_record> result;
+    for (auto&& p : records) result.push_back(p.second);
+    return result;
+}
+
+// Resetting is only reliable when no profiled functions are running
+inline void profile_reset()
+{
+    detail::profile_registry& r = detail::get_profile_registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    r.retired.clear();
+    for (detail::profile_thread_table* t : r.tables)
+    {
+        std::lock_guard<std::mutex> table_lock(t->m);
+        for (auto&& p : t->counters) p.second.reset();
+    }
+}
+
+inline void profile_write(std::ostream& os, profile_format format=profile_format::text)
+{
+    std::vector<profile_record> records = profile_snapshot();
+    if (format == profile_format::json)
+    {
+        os << "[";
+        for (std::size_t i = 0; i < records.size(); i++)
+        {
+            const profile_record& r = records[i];
+            if (i > 0) os << ",";
+            os << "\n  {\"name\": ";
+            detail::write_json_string(os, r.name.c_str());
+            os << ", \"count\": " << r.count
+               << ", \"total_ns\": " << r.total
+               << ", \"min_ns\": " << r.min
+               << ", \"max_ns\": " << r.max
+               << ", \"histogram\": [";
+            for (std::size_t j = 0; j < r.histogram.size(); j++)
+                os << (j > 0 ? ", " : "") << r.histogram[j];
+            os << "]}";
+        }
+        os << "\n]\n";
+    }
+    else
+    {
+        for (const profile_record& r : records)
+        {
+            os << r.name
+               << ": count=" << r.count
+               << " total_ns=" << r.total
+               << " mean_ns=" << (r.count > 0 ? r.total / r.count : 0)
+               << " min_ns=" << r.min
+               << " max_ns=" << r.max
+               << " histogram=";
+            for (std::size_t j = 0; j < r.histogram.size(); j++)
+            {
+                if (r.histogram[j] > 0) os << "[2^" << j << "]=" << r.histogram[j] << " ";
+            }
+            os << "\n";
+        }
+    }
+}
+
+inline bool profile_dump(const char* filename, profile_format format=profile_format::text)
+{
+    std::ofstream os(filename);
+    if (!os) return false;
+    profile_write(os, format);
+    return static_cast<bool>(os);
+}
+
+namespace detail {
+
+#if FIT_PROFILE
+typedef profile_scope profile_call_scope;
+#else
+typedef void profile_call_scope;
+#endif
+
+}
+
+template<class F>
+struct profile_adaptor : detail::named_adaptor<F, detail::profile_call_scope>
+{
+    typedef detail::named_adaptor<F, detail::profile_call_scope> base_type;
+
+    FIT_INHERIT_DEFAULT(profile_adaptor, base_type)
+
+    FIT_INHERIT_CONSTRUCTOR(profile_adaptor, base_type);
+};
+
+namespace detail {
+
+struct profile_f
+{
+    template<class F>
+    constexpr profile_adaptor<F> operator()(F f) const
+    {
+        return profile_adaptor<F>(fit::move(f));
+    }
+
+    template<class F>
+    constexpr profile_adaptor<F> operator()(F f, const char* name) const
+    {
+        return profile_adaptor<F>(fit::move(f), name);
+    }
+};
+
+}
+
+FIT_DECLARE_STATIC_VAR(profile, detail::profile_f);
+
+} // namespace fit
+
+#endif
@@ -0,0 +1,233 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    reduce.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_REDUCE_H
+#define FIT_GUARD_REDUCE_H
+
+/// reduce
+/// ======
+/// 
+/// Description
+/// -----------
+/// 
+/// The `reduce` function adaptor folds the elements of a random access range
+/// with an associative binary function, using several threads. The range is
+/// split into one chunk for each thread, each chunk is folded with the
+/// function, and then the results of the chunks are folded in order. When a
+/// number of threads is not given, `std::thread::hardware_concurrency()` is
+/// used. The thread that calls the function folds the first chunk, and the
+/// other chunks are folded with `std::async`. Ranges smaller than
+/// `FIT_REDUCE_CHUNK_SIZE` elements for each thread use fewer threads.
+/// 
+/// When the function is a [`compress`](compress.md) adaptor, its binary
+/// function is used, and when it has an initial state, the state is folded
+/// before the elements, so `reduce(compress(f, z))(r)` is the same as
+/// `compress(f, z)` called with the elements of the range, except for the
+/// order the calls are grouped.
+/// 
+/// Since the chunks depend on the number of threads, the result of a function
+/// that is not exactly associative, such as adding floating point numbers,
+/// can change with the number of threads. The `deterministic_reduce` adaptor
+/// always splits the range into chunks of `FIT_REDUCE_CHUNK_SIZE` elements,
+/// and the threads fold whole chunks. The results of the chunks are folded in
+/// the same order, so the result is the same for any number of threads.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     constexpr reduce_adaptor<F> reduce(F f);
+/// 
+///     template<class F>
+///     constexpr reduce_adaptor<F, true> deterministic_reduce(F f);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     assert(reduce(f)(r) == compress(f)(r[0], r[1], ..., r[n-1]));
+///     assert(reduce(compress(f, z))(r) == compress(f, z)(r[0], r[1], ..., r[n-1]));
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [BinaryCallable](concepts.md#binarycallable)
+/// * MoveConstructible
+/// 
+/// The function must be associative, and it must be safe to call it from
+/// several threads at the same time. The range must be a random access range,
+/// and it must not be empty unless the function is a `compress` adaptor with
+/// an initial state.
+/// 
+/// Example
+/// -------
+/// 
+///     struct sum_f
+///     {
+///         template<class T, class U>
+///         T operator()(T x, U y) const
+///         {
+///             return x + y;
+///         }
+///     };
+/// 
+///     std::vector<double> v(1000000, 0.5);
+///     assert(fit::reduce(sum_f())(v) == 500000.0);
+///     assert(fit::deterministic_reduce(fit::compress(sum_f(), 1.0))(v, 4) == 500001.0);
+/// 
+
+#ifndef FIT_REDUCE_CHUNK_SIZE
+#define FIT_REDUCE_CHUNK_SIZE 4096
+#endif
+
+#include <fit/compress.hpp>
+#include <fit/detail/always_ref.hpp>
+#include <fit/detail/callable_base.hpp>
+#include <fit/detail/delegate.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fit { namespace detail {
+
+template<class R, class F, class Iterator>
+R reduce_chunk(const F& f, Iterator first, Iterator last)
+{
+    R result(*first);
+    for (++first; first != last; ++first) result = f(fit::move(result), *first);
+    return result;
+}
+
+template<class R, class F, class Iterator>
+R reduce_parallel(const F& f, Iterator first, Iterator last, std::size_t threads, bool deterministic)
+{
+    const std::size_t n = last - first;
+    std::size_t chunk_size = FIT_REDUCE_CHUNK_SIZE;
+    std::size_t chunks = (n + chunk_size - 1) / chunk_size;
+    threads = std::max<std::size_t>(1, std::min(threads, chunks));
+    if (!deterministic)
+    {
+        // Rounding the size up can leave fewer chunks than threads, and the
+        // chunks past the end would be empty
+        chunk_size = (n + threads - 1) / threads;
+        chunks = (n + chunk_size - 1) / chunk_size;
+        threads = chunks;
+    }
+    // Each thread folds the chunks from b to e separately
+    auto fold_chunks = [&](std::size_t b, std::size_t e)
+    {
+        std::vector<R> results;
+        results.reserve(e - b);
+        for (std::size_t c = b; c < e; c++)
+        {
+            results.push_back(reduce_chunk<R>(f, first + c * chunk_size, first + std::min(n, (c + 1) * chunk_size)));
+        }
+        return results;
+    };
+    std::vector<std::future<std::vector<R>>> futures;
+    futures.reserve(threads - 1);
+    for (std::size_t t = 1; t < threads; t++)
+    {
+        futures.push_back(std::async(std::launch::async, fold_chunks, t * chunks / threads, (t + 1) * chunks / threads));
+    }
+    std::vector<R> results = fold_chunks(0, chunks / threads);
+    for (auto& x : futures)
+    {
+        std::vector<R> r = x.get();
+        std::move(r.begin(), r.end(), std::back_inserter(results));
+    }
+    R result = fit::move(results.front());
+    for (std::size_t i = 1; i < results.size(); i++) result = f(fit::move(result), fit::move(results[i]));
+    return result;
+}
+
+template<class F, class Iterator, class R=typename std::decay<
+    decltype(std::declval<const F&>()(*std::declval<Iterator>(), *std::declval<Iterator>()))
+>::type>
+R reduce_range(const F& f, Iterator first, Iterator last, std::size_t threads, bool deterministic)
+{
+    return detail::reduce_parallel<R>(f, first, last, threads, deterministic);
+}
+
+template<class F, class Iterator>
+auto reduce_range(const compress_adaptor<F>& f, Iterator first, Iterator last, std::size_t threads, bool deterministic)
+-> decltype(detail::reduce_range(f.base_function(), first, last, threads, deterministic))
+{
+    return detail::reduce_range(f.base_function(), first, last, threads, deterministic);
+}
+
+template<class F, class State, class Iterator, class R=typename std::decay<decltype(
+    std::declval<const compress_adaptor<F, State>&>().base_function()(
+        std::declval<State>(),
+        detail::reduce_range(std::declval<const compress_adaptor<F, State>&>().base_function(), std::declval<Iterator>(), std::declval<Iterator>(), 0, false)
+    )
+)>::type>
+R reduce_range(const compress_adaptor<F, State>& f, Iterator first, Iterator last, std::size_t threads, bool deterministic)
+{
+    if (first == last) return R(f.get_state());
+    return f.base_function()(f.get_state(), detail::reduce_range(f.base_function(), first, last, threads, deterministic));
+}
+
+inline std::size_t reduce_threads()
+{
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+}
+
+template<class F, bool Deterministic>
+struct reduce_adaptor : detail::callable_base<F>
+{
+    FIT_INHERIT_CONSTRUCTOR(reduce_adaptor, detail::callable_base<F>)
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const
+    {
+        return always_ref(*this)(xs...);
+    }
+
+    template<class Range>
+    auto operator()(Range&& r, std::size_t threads) const
+    -> decltype(detail::reduce_range(std::declval<const detail::callable_base<F>&>(), std::begin(r), std::end(r), threads, Deterministic))
+    {
+        return detail::reduce_range(this->base_function(r), std::begin(r), std::end(r), threads, Deterministic);
+    }
+
+    template<class Range>
+    auto operator()(Range&& r) const
+    -> decltype(detail::reduce_range(std::declval<const detail::callable_base<F>&>(), std::begin(r), std::end(r), 1, Deterministic))
+    {
+        return detail::reduce_range(this->base_function(r), std::begin(r), std::end(r), detail::reduce_threads(), Deterministic);
+    }
+};
+
+namespace detail {
+
+template<bool Deterministic>
+struct reduce_f
+{
+    template<class F>
+    constexpr reduce_adaptor<F, Deterministic> operator()(F f) const
+    {
+        return reduce_adaptor<F, Deterministic>(fit::move(f));
+    }
+};
+
+}
+
+FIT_DECLARE_STATIC_VAR(reduce, detail::reduce_f<false>);
+FIT_DECLARE_STATIC_VAR(deterministic_reduce, detail::reduce_f<true>);
+
+} // namespace fit
+
+#endif
@@ -47,7 +47,6 @@
 ///     assert(increment_by_5(1) == 6);
 /// 
 
-#include <fit/always.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/result_of.hpp>
 #include <fit/detail/move.hpp>
@@ -65,7 +65,6 @@
 ///     static_assert(std::is_same<six, decltype(increment_until_6(one()))>::value, "Error");
 /// 
 
-#include <fit/always.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/result_of.hpp>
 #include <fit/detail/move.hpp>
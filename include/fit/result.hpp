@@ -52,7 +52,7 @@
 
 #include <fit/detail/callable_base.hpp>
 #include <fit/is_callable.hpp>
-#include <fit/always.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/reveal.hpp>
 
 namespace fit {
@@ -36,7 +36,6 @@
 /// * MoveConstructible
 /// 
 
-#include <fit/always.hpp>
 #include <fit/returns.hpp>
 #include <fit/is_callable.hpp>
 #include <fit/identity.hpp>
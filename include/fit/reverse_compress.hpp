@@ -23,6 +23,9 @@
 /// The arguments to the binary function, take first the state and then the
 /// argument.
 /// 
+/// When the function is wrapped with [`associative`](associative.md), the
+/// arguments are folded pairwise as a balanced tree instead.
+/// 
 /// Synopsis
 /// --------
 /// 
@@ -66,6 +69,9 @@
 ///     assert(fit::reverse_compress(max_f())(2, 3, 4, 5) == 5);
 /// 
 
+#include <fit/fwd.hpp>
+#include <fit/associative.hpp>
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/callable_base.hpp>
 #include <fit/detail/delegate.hpp>
 #include <fit/detail/compressed_pair.hpp>
@@ -85,6 +91,12 @@ struct v_reverse_fold
         f((*FIT_CONST_THIS)(f, fit::forward<State>(state), fit::forward<Ts>(xs)...), fit::forward<T>(x))
     );
 
+    template<class F, class State, class T, class... Ts>
+    constexpr auto operator()(const associative_adaptor<F>& f, State&& state, T&& x, Ts&&... xs) const FIT_RETURNS
+    (
+        tree_fold<true>()(f, fit::forward<State>(state), fit::forward<T>(x), fit::forward<Ts>(xs)...)
+    );
+
     template<class F, class State>
     constexpr State operator()(const F&, State&& state) const 
     {
@@ -94,7 +106,7 @@ struct v_reverse_fold
 
 }
 
-template<class F, class State=void>
+template<class F, class State>
 struct reverse_compress_adaptor
 : detail::compressed_pair<detail::callable_base<F>, State>
 {
@@ -43,6 +43,7 @@
 ///     assert(r == 3);
 /// 
 
+#include <fit/detail/always_ref.hpp>
 #include <fit/detail/result_of.hpp>
 #include <fit/reveal.hpp>
 #include <fit/detail/make.hpp>
@@ -0,0 +1,204 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    shared.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_SHARED_H
+#define FIT_GUARD_SHARED_H
+
+/// shared
+/// ======
+/// 
+/// Description
+/// -----------
+/// 
+/// The `shared` function adaptor moves the function into a reference counted
+/// block, which is never modified after it is created. Copying the adaptor
+/// only increments the count, so functions with large state, such as a
+/// lookup table, can be copied cheaply by the other adaptors, and by
+/// algorithms that take function objects by value, such as `std::sort`. The
+/// function is called as const.
+/// 
+/// The count is atomic, so copies of the adaptor can be made and destroyed
+/// from several threads. The `local_shared` adaptor uses a count that is not
+/// atomic, which is cheaper, but all copies must be made and destroyed in
+/// the same thread.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     shared_adaptor<F> shared(F f);
+/// 
+///     template<class F>
+///     shared_adaptor<F, false> local_shared(F f);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     assert(shared(f)(xs...) == f(xs...));
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// Example
+/// -------
+/// 
+///     struct rank_less
+///     {
+///         std::vector<int> rank;
+///         bool operator()(int x, int y) const
+///         {
+///             return rank[x] < rank[y];
+///         }
+///     };
+/// 
+///     std::vector<int> v = { 2, 0, 1 };
+///     std::sort(v.begin(), v.end(), fit::shared(rank_less{ { 3, 2, 1 } }));
+///     assert(v == std::vector<int>({ 2, 1, 0 }));
+/// 
+
+#include <fit/fwd.hpp>
+#include <fit/detail/result_of.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace fit { namespace detail {
+
+template<bool Atomic>
+struct shared_count
+{
+    std::atomic<std::size_t> n;
+
+    shared_count() : n(1)
+    {}
+
+    void increment()
+    {
+        n.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns true when the last reference is released
+    bool decrement()
+    {
+        return n.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    std::size_t get() const
+    {
+        return n.load(std::memory_order_relaxed);
+    }
+};
+
+template<>
+struct shared_count<false>
+{
+    std::size_t n;
+
+    shared_count() : n(1)
+    {}
+
+    void increment()
+    {
+        n++;
+    }
+
+    bool decrement()
+    {
+        return --n == 0;
+    }
+
+    std::size_t get() const
+    {
+        return n;
+    }
+};
+
+template<class F, bool Atomic>
+struct shared_block
+{
+    const F f;
+    shared_count<Atomic> count;
+
+    shared_block(F x) : f(fit::move(x))
+    {}
+};
+
+}
+
+template<class F, bool Atomic>
+struct shared_adaptor
+{
+    detail::shared_block<F, Atomic>* block;
+
+    shared_adaptor(F f) : block(new detail::shared_block<F, Atomic>(fit::move(f)))
+    {}
+
+    shared_adaptor(const shared_adaptor& x) : block(x.block)
+    {
+        if (block != nullptr) block->count.increment();
+    }
+
+    shared_adaptor(shared_adaptor&& x) noexcept : block(x.block)
+    {
+        x.block = nullptr;
+    }
+
+    shared_adaptor& operator=(shared_adaptor x) noexcept
+    {
+        std::swap(block, x.block);
+        return *this;
+    }
+
+    ~shared_adaptor()
+    {
+        if (block != nullptr && block->count.decrement()) delete block;
+    }
+
+    const F& base_function() const
+    {
+        return block->f;
+    }
+
+    std::size_t use_count() const
+    {
+        return block == nullptr ? 0 : block->count.get();
+    }
+
+    FIT_RETURNS_CLASS(shared_adaptor);
+
+    template<class... Ts>
+    FIT_SFINAE_RESULT(const F&, id_<Ts>...)
+    operator()(Ts&&... xs) const FIT_SFINAE_RETURNS(FIT_CONST_THIS->base_function()(fit::forward<Ts>(xs)...));
+};
+
+namespace detail {
+
+template<bool Atomic>
+struct shared_f
+{
+    template<class F>
+    shared_adaptor<F, Atomic> operator()(F f) const
+    {
+        return shared_adaptor<F, Atomic>(fit::move(f));
+    }
+};
+
+}
+
+FIT_DECLARE_STATIC_VAR(shared, detail::shared_f<true>);
+FIT_DECLARE_STATIC_VAR(local_shared, detail::shared_f<false>);
+
+} // namespace fit
+
+#endif
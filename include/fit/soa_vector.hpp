@@ -0,0 +1,494 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    soa_vector.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_SOA_VECTOR_H
+#define FIT_GUARD_SOA_VECTOR_H
+
+/// soa_vector
+/// ==========
+/// 
+/// Description
+/// -----------
+/// 
+/// The `soa_vector` class is a container of records, where each field of
+/// the records is stored contiguously in its own column, instead of storing
+/// the records one after the other like `std::vector<std::tuple<Ts...>>`.
+/// A loop that only reads one or two fields of each record then only loads
+/// those fields from memory.
+/// 
+/// A row is accessed as a [`pack`](pack.md) of references to its fields, as
+/// if it was created with `pack_forward`, so it can be used with
+/// [`unpack`](unpack.md) and the functions that work with packs. A column is
+/// accessed with `column<I>()`, which returns a `soa_span` over the
+/// contiguous elements of the I-th field. A `bool` field is stored as an
+/// array of `bool`, instead of packing the values into bits like
+/// `std::vector<bool>`, so its elements can be referenced as well.
+/// 
+/// If adding a row throws an exception, the container is left unchanged.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class T>
+///     struct soa_span
+///     {
+///         T* data() const;
+///         std::size_t size() const;
+///         T* begin() const;
+///         T* end() const;
+///         T& operator[](std::size_t i) const;
+///     };
+/// 
+///     template<class... Ts>
+///     struct soa_vector
+///     {
+///         std::size_t size() const;
+///         bool empty() const;
+///         void reserve(std::size_t n);
+///         void resize(std::size_t n);
+///         void clear();
+/// 
+///         template<class... Xs>
+///         void push_back(Xs&&... xs);
+///         void pop_back();
+/// 
+///         auto operator[](std::size_t i);
+///         auto operator[](std::size_t i) const;
+/// 
+///         template<std::size_t I>
+///         soa_span<T> column();
+///         template<std::size_t I>
+///         soa_span<const T> column() const;
+/// 
+///         iterator begin();
+///         iterator end();
+///         const_iterator begin() const;
+///         const_iterator end() const;
+///     };
+/// 
+/// Requirements
+/// ------------
+/// 
+/// Each type in Ts must be:
+/// 
+/// * MoveConstructible
+/// 
+/// Example
+/// -------
+/// 
+///     struct scale
+///     {
+///         void operator()(float& x, float& y, int) const
+///         {
+///             x *= 2;
+///             y *= 2;
+///         }
+///     };
+/// 
+///     fit::soa_vector<float, float, int> points;
+///     points.push_back(1.0f, 2.0f, 0);
+///     points.push_back(3.0f, 4.0f, 1);
+///     for(auto row:points) fit::unpack(scale())(row);
+/// 
+///     float sum = 0;
+///     for(float x:points.column<0>()) sum += x;
+///     assert(sum == 8.0f);
+/// 
+
+#include <fit/pack.hpp>
+#include <fit/detail/forward.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/seq.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace fit {
+
+template<class T>
+struct soa_span
+{
+    soa_span(T* p, std::size_t np) : first(p), n(np)
+    {}
+
+    T* data() const
+    {
+        return first;
+    }
+
+    std::size_t size() const
+    {
+        return n;
+    }
+
+    bool empty() const
+    {
+        return n == 0;
+    }
+
+    T* begin() const
+    {
+        return first;
+    }
+
+    T* end() const
+    {
+        return first + n;
+    }
+
+    T& operator[](std::size_t i) const
+    {
+        return first[i];
+    }
+
+private:
+    T* first;
+    std::size_t n;
+};
+
+namespace detail {
+
+// A column of bools, since std::vector<bool> packs them into bits, so its
+// elements can't be referenced and it has no data()
+struct soa_bool_vector
+{
+    soa_bool_vector() : n(0), cap(0)
+    {}
+
+    soa_bool_vector(const soa_bool_vector& rhs) : n(0), cap(0)
+    {
+        this->reserve(rhs.n);
+        std::copy(rhs.data(), rhs.data() + rhs.n, this->data());
+        n = rhs.n;
+    }
+
+    soa_bool_vector(soa_bool_vector&& rhs) : p(fit::move(rhs.p)), n(rhs.n), cap(rhs.cap)
+    {
+        rhs.n = 0;
+        rhs.cap = 0;
+    }
+
+    soa_bool_vector& operator=(soa_bool_vector rhs)
+    {
+        std::swap(p, rhs.p);
+        std::swap(n, rhs.n);
+        std::swap(cap, rhs.cap);
+        return *this;
+    }
+
+    std::size_t size() const
+    {
+        return n;
+    }
+
+    std::size_t capacity() const
+    {
+        return cap;
+    }
+
+    bool* data()
+    {
+        return p.get();
+    }
+
+    const bool* data() const
+    {
+        return p.get();
+    }
+
+    bool& operator[](std::size_t i)
+    {
+        return p[i];
+    }
+
+    const bool& operator[](std::size_t i) const
+    {
+        return p[i];
+    }
+
+    void reserve(std::size_t m)
+    {
+        if (m <= cap) return;
+        std::unique_ptr<bool[]> q(new bool[m]);
+        std::copy(this->data(), this->data() + n, q.get());
+        p = fit::move(q);
+        cap = m;
+    }
+
+    void resize(std::size_t m)
+    {
+        this->reserve(m);
+        if (m > n) std::fill(this->data() + n, this->data() + m, false);
+        n = m;
+    }
+
+    void clear()
+    {
+        n = 0;
+    }
+
+    void push_back(bool x)
+    {
+        if (n == cap) this->reserve(cap == 0 ? 1 : 2 * cap);
+        p[n++] = x;
+    }
+
+    void pop_back()
+    {
+        --n;
+    }
+
+private:
+    std::unique_ptr<bool[]> p;
+    std::size_t n;
+    std::size_t cap;
+};
+
+template<class T>
+struct soa_storage
+{
+    typedef std::vector<T> type;
+};
+
+template<>
+struct soa_storage<bool>
+{
+    typedef soa_bool_vector type;
+};
+
+template<std::size_t I, class T>
+struct soa_column
+{
+    typename soa_storage<T>::type data;
+};
+
+template<std::size_t I, class T>
+typename soa_storage<T>::type& soa_get(soa_column<I, T>& c)
+{
+    return c.data;
+}
+
+template<std::size_t I, class T>
+const typename soa_storage<T>::type& soa_get(const soa_column<I, T>& c)
+{
+    return c.data;
+}
+
+template<class Container, class Reference>
+struct soa_iterator
+{
+    typedef std::input_iterator_tag iterator_category;
+    typedef Reference value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef Reference reference;
+
+    Container* c;
+    std::size_t i;
+
+    soa_iterator(Container* cp, std::size_t ip) : c(cp), i(ip)
+    {}
+
+    Reference operator*() const
+    {
+        return (*c)[i];
+    }
+
+    soa_iterator& operator++()
+    {
+        ++i;
+        return *this;
+    }
+
+    soa_iterator operator++(int)
+    {
+        soa_iterator r = *this;
+        ++i;
+        return r;
+    }
+
+    friend bool operator==(const soa_iterator& x, const soa_iterator& y)
+    {
+        return x.i == y.i;
+    }
+
+    friend bool operator!=(const soa_iterator& x, const soa_iterator& y)
+    {
+        return x.i != y.i;
+    }
+};
+
+template<class Seq, class... Ts>
+struct soa_base;
+
+template<std::size_t... Ns, class... Ts>
+struct soa_base<seq<Ns...>, Ts...>
+: soa_column<Ns, Ts>...
+{
+    typedef decltype(pack_forward_f()(std::declval<Ts&>()...)) reference;
+    typedef decltype(pack_forward_f()(std::declval<const Ts&>()...)) const_reference;
+    typedef soa_iterator<soa_base, reference> iterator;
+    typedef soa_iterator<const soa_base, const_reference> const_iterator;
+
+    std::size_t size() const
+    {
+        return soa_get<0>(*this).size();
+    }
+
+    bool empty() const
+    {
+        return this->size() == 0;
+    }
+
+    void reserve(std::size_t n)
+    {
+        int x[] = { (soa_get<Ns>(*this).reserve(n), 0)... };
+        (void)x;
+    }
+
+    void resize(std::size_t n)
+    {
+        int x[] = { (soa_get<Ns>(*this).resize(n), 0)... };
+        (void)x;
+    }
+
+    void clear()
+    {
+        int x[] = { (soa_get<Ns>(*this).clear(), 0)... };
+        (void)x;
+    }
+
+    template<class... Xs>
+    void push_back(Xs&&... xs)
+    {
+        static_assert(sizeof...(Xs) == sizeof...(Ts), "There must be a value for each column");
+        std::size_t n = this->size();
+        if (this->full())
+        {
+            // The arguments may refer to elements of the container, so the
+            // new values are built before the columns are reallocated
+            std::tuple<Ts...> values(fit::forward<Xs>(xs)...);
+            this->reserve(n == 0 ? 1 : 2 * n);
+            this->append(n, std::get<Ns>(fit::move(values))...);
+        }
+        else
+        {
+            this->append(n, fit::forward<Xs>(xs)...);
+        }
+    }
+
+    void pop_back()
+    {
+        int x[] = { (soa_get<Ns>(*this).pop_back(), 0)... };
+        (void)x;
+    }
+
+    reference operator[](std::size_t i)
+    {
+        return pack_forward_f()(soa_get<Ns>(*this)[i]...);
+    }
+
+    const_reference operator[](std::size_t i) const
+    {
+        return pack_forward_f()(soa_get<Ns>(*this)[i]...);
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, this->size());
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, this->size());
+    }
+
+    template<std::size_t I>
+    auto column() -> soa_span<typename std::remove_reference<decltype(soa_get<I>(*this)[0])>::type>
+    {
+        auto& c = soa_get<I>(*this);
+        return { c.data(), c.size() };
+    }
+
+    template<std::size_t I>
+    auto column() const -> soa_span<typename std::remove_reference<decltype(soa_get<I>(*this)[0])>::type>
+    {
+        auto& c = soa_get<I>(*this);
+        return { c.data(), c.size() };
+    }
+
+private:
+    // Removes the elements that were added when a constructor throws
+    struct truncate_guard
+    {
+        soa_base* self;
+        std::size_t n;
+
+        ~truncate_guard()
+        {
+            if (self) self->truncate(n);
+        }
+    };
+
+    bool full() const
+    {
+        bool r = false;
+        int x[] = { (r = r || soa_get<Ns>(*this).size() == soa_get<Ns>(*this).capacity(), 0)... };
+        (void)x;
+        return r;
+    }
+
+    // Every column has room for the new row, so only the constructors of
+    // the elements can throw
+    template<class... Xs>
+    void append(std::size_t n, Xs&&... xs)
+    {
+        truncate_guard guard = { this, n };
+        int x[] = { (soa_get<Ns>(*this).push_back(fit::forward<Xs>(xs)), 0)... };
+        (void)x;
+        guard.self = nullptr;
+    }
+
+    void truncate(std::size_t n)
+    {
+        int x[] = { (this->truncate_column(soa_get<Ns>(*this), n), 0)... };
+        (void)x;
+    }
+
+    template<class Column>
+    static void truncate_column(Column& c, std::size_t n)
+    {
+        while (c.size() > n) c.pop_back();
+    }
+};
+
+}
+
+template<class... Ts>
+struct soa_vector
+: detail::soa_base<typename detail::gens<sizeof...(Ts)>::type, Ts...>
+{
+    static_assert(sizeof...(Ts) > 0, "There must be at least one column");
+};
+
+} // namespace fit
+
+#endif
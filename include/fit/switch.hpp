@@ -0,0 +1,592 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    switch.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_SWITCH_H
+#define FIT_GUARD_SWITCH_H
+
+/// switch_
+/// =======
+/// 
+/// Description
+/// -----------
+/// 
+/// The `switch_` function adaptor dispatches on a runtime value, such as an
+/// opcode or an enum. Unlike [`conditional`](conditional.md), which picks a
+/// function at compile time, the function called is selected by the first
+/// argument passed to the adaptor. The rest of the arguments are forwarded
+/// to the selected function.
+/// 
+/// Functions are paired with compile-time keys using `case_`, with runtime
+/// predicates on the key using `when`, and a fallback can be given with
+/// `default_`. The keyed cases are compiled into a jump table when the keys
+/// are dense, and into a sorted array searched with binary search when they
+/// are sparse. The predicates are only tried, in order, when no key matches,
+/// and the default is called when nothing else does. If there is no default,
+/// a value-initialized result is returned.
+/// 
+/// The result type is the common type of the results of all the functions.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class... Cases>
+///     constexpr switch_adaptor<Cases...> switch_(Cases... cases);
+/// 
+///     template<std::intmax_t Key, class F>
+///     constexpr case_adaptor<std::integral_constant<std::intmax_t, Key>, F> case_(F f);
+/// 
+///     template<class IntegralConstant, class F>
+///     constexpr case_adaptor<IntegralConstant, F> case_(IntegralConstant, F f);
+/// 
+///     template<class P, class F>
+///     constexpr when_adaptor<P, F> when(P p, F f);
+/// 
+///     template<class F>
+///     constexpr default_adaptor<F> default_(F f);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     assert(switch_(case_<K>(f), xs...)(K, ys...) == f(ys...));
+///     assert(switch_(when(p, f), xs...)(k, ys...) == (p(k) ? f(ys...) : switch_(xs...)(k, ys...)));
+///     assert(switch_(default_(f))(k, ys...) == f(ys...));
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// P must be:
+/// 
+/// * [UnaryCallable](concepts.md#unarycallable)
+/// * MoveConstructible
+/// 
+/// The key passed to the adaptor must be an integral or enumeration type, and
+/// each key used with `case_` must be unique.
+/// 
+/// Example
+/// -------
+/// 
+///     enum class opcode { push, pop, add };
+/// 
+///     auto exec = fit::switch_(
+///         fit::case_(std::integral_constant<opcode, opcode::push>(), push_f()),
+///         fit::case_(std::integral_constant<opcode, opcode::pop>(), pop_f()),
+///         fit::case_(std::integral_constant<opcode, opcode::add>(), add_f()),
+///         fit::default_(trap_f())
+///     );
+///     exec(op, stack);
+/// 
+
+#include <fit/detail/callable_base.hpp>
+#include <fit/detail/compressed_pair.hpp>
+#include <fit/detail/delegate.hpp>
+#include <fit/detail/holder.hpp>
+#include <fit/detail/seq.hpp>
+#include <fit/detail/and.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/make.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <cstdint>
+#include <type_traits>
+
+namespace fit {
+
+template<class Key, class F>
+struct case_adaptor : detail::callable_base<F>
+{
+    typedef Key fit_switch_key;
+    FIT_INHERIT_CONSTRUCTOR(case_adaptor, detail::callable_base<F>);
+};
+
+template<std::intmax_t Key, class F>
+constexpr case_adaptor<std::integral_constant<std::intmax_t, Key>, F> case_(F f)
+{
+    return case_adaptor<std::integral_constant<std::intmax_t, Key>, F>(fit::move(f));
+}
+
+template<class IntegralConstant, class F>
+constexpr case_adaptor<IntegralConstant, F> case_(IntegralConstant, F f)
+{
+    return case_adaptor<IntegralConstant, F>(fit::move(f));
+}
+
+template<class P, class F>
+struct when_adaptor
+: detail::compressed_pair<detail::callable_base<P>, detail::callable_base<F>>
+{
+    typedef void fit_switch_when;
+    typedef detail::compressed_pair<detail::callable_base<P>, detail::callable_base<F>> base_type;
+    FIT_INHERIT_CONSTRUCTOR(when_adaptor, base_type);
+
+    template<class... Ts>
+    constexpr const detail::callable_base<P>& predicate(Ts&&... xs) const
+    {
+        return this->first(xs...);
+    }
+
+    template<class... Ts>
+    constexpr const detail::callable_base<F>& base_function(Ts&&... xs) const
+    {
+        return this->second(xs...);
+    }
+};
+
+template<class F>
+struct default_adaptor : detail::callable_base<F>
+{
+    typedef void fit_switch_default;
+    FIT_INHERIT_CONSTRUCTOR(default_adaptor, detail::callable_base<F>);
+};
+
+namespace detail {
+
+template<class T, class=void>
+struct is_switch_case
+: std::false_type
+{};
+
+template<class T>
+struct is_switch_case<T, typename holder<typename T::fit_switch_key>::type>
+: std::true_type
+{};
+
+template<class T, class=void>
+struct is_switch_when
+: std::false_type
+{};
+
+template<class T>
+struct is_switch_when<T, typename holder<typename T::fit_switch_when>::type>
+: std::true_type
+{};
+
+template<class T, class=void>
+struct is_switch_default
+: std::false_type
+{};
+
+template<class T>
+struct is_switch_default<T, typename holder<typename T::fit_switch_default>::type>
+: std::true_type
+{};
+
+// Select the indices of the cases that satisfy the trait
+template<template<class, class> class Trait, class Seq, std::size_t I, class... Ts>
+struct switch_select;
+
+template<template<class, class> class Trait, std::size_t... Is, std::size_t I>
+struct switch_select<Trait, seq<Is...>, I>
+{
+    typedef seq<Is...> type;
+};
+
+template<template<class, class> class Trait, std::size_t... Is, std::size_t I, class T, class... Ts>
+struct switch_select<Trait, seq<Is...>, I, T, Ts...>
+: switch_select<Trait, typename std::conditional<Trait<T, void>::value,
+    seq<Is..., I>,
+    seq<Is...>
+>::type, I+1, Ts...>
+{};
+
+template<std::intmax_t Key, std::size_t Index>
+struct switch_entry
+{
+    static constexpr std::intmax_t key = Key;
+    static constexpr std::size_t index = Index;
+};
+
+template<class... Ps>
+struct switch_min
+: std::integral_constant<std::intmax_t, INTMAX_MAX>
+{};
+
+template<class P, class... Ps>
+struct switch_min<P, Ps...>
+: std::integral_constant<std::intmax_t, (P::key < switch_min<Ps...>::value ? P::key : switch_min<Ps...>::value)>
+{};
+
+template<class... Ps>
+struct switch_max
+: std::integral_constant<std::intmax_t, INTMAX_MIN>
+{};
+
+template<class P, class... Ps>
+struct switch_max<P, Ps...>
+: std::integral_constant<std::intmax_t, (P::key > switch_max<Ps...>::value ? P::key : switch_max<Ps...>::value)>
+{};
+
+// Number of entries whose key is less than K
+template<std::intmax_t K, class... Ps>
+struct switch_rank
+: std::integral_constant<std::size_t, 0>
+{};
+
+template<std::intmax_t K, class P, class... Ps>
+struct switch_rank<K, P, Ps...>
+: std::integral_constant<std::size_t, (P::key < K ? 1 : 0) + switch_rank<K, Ps...>::value>
+{};
+
+// Number of entries whose key is equal to K
+template<std::intmax_t K, class... Ps>
+struct switch_count
+: std::integral_constant<std::size_t, 0>
+{};
+
+template<std::intmax_t K, class P, class... Ps>
+struct switch_count<K, P, Ps...>
+: std::integral_constant<std::size_t, (P::key == K ? 1 : 0) + switch_count<K, Ps...>::value>
+{};
+
+// Find the entry with the Nth smallest key
+template<std::size_t N, class Qs, class... Ps>
+struct switch_nth;
+
+template<std::size_t N, class... Qs, class P, class... Ps>
+struct switch_nth<N, holder<Qs...>, P, Ps...>
+: std::conditional<(switch_rank<P::key, Qs...>::value == N),
+    P,
+    switch_nth<N, holder<Qs...>, Ps...>
+>::type
+{};
+
+// Find the entry with the key K, otherwise use Fallback
+template<std::intmax_t K, class Fallback, class... Ps>
+struct switch_find
+: Fallback
+{};
+
+template<std::intmax_t K, class Fallback, class P, class... Ps>
+struct switch_find<K, Fallback, P, Ps...>
+: std::conditional<(P::key == K),
+    P,
+    switch_find<K, Fallback, Ps...>
+>::type
+{};
+
+template<class R, class Self, class Key, class... Ts>
+struct switch_call
+{
+    typedef R(*function_type)(const Self&, const Key&, Ts&&...);
+
+    template<std::size_t I>
+    static R call_case(const Self& self, const Key&, Ts&&... xs)
+    {
+        return static_cast<R>(self.template get_case<I>(xs...)(fit::forward<Ts>(xs)...));
+    }
+
+    static R call_default(const Self&, seq<>, Ts&&...)
+    {
+        return R();
+    }
+
+    template<std::size_t I>
+    static R call_default(const Self& self, seq<I>, Ts&&... xs)
+    {
+        return static_cast<R>(self.template get_case<I>(xs...)(fit::forward<Ts>(xs)...));
+    }
+
+    static R call_when(const Self& self, const Key&, seq<>, Ts&&... xs)
+    {
+        return call_default(self, typename Self::default_seq(), fit::forward<Ts>(xs)...);
+    }
+
+    template<std::size_t I, std::size_t... Is>
+    static R call_when(const Self& self, const Key& key, seq<I, Is...>, Ts&&... xs)
+    {
+        return self.template get_case<I>(xs...).predicate(xs...)(key) ?
+            static_cast<R>(self.template get_case<I>(xs...).base_function(xs...)(fit::forward<Ts>(xs)...)) :
+            call_when(self, key, seq<Is...>(), fit::forward<Ts>(xs)...);
+    }
+
+    static R call_fallback(const Self& self, const Key& key, Ts&&... xs)
+    {
+        return call_when(self, key, typename Self::when_seq(), fit::forward<Ts>(xs)...);
+    }
+
+    template<class P>
+    static constexpr function_type get_function(std::true_type)
+    {
+        return &call_case<P::index>;
+    }
+
+    template<class P>
+    static constexpr function_type get_function(std::false_type)
+    {
+        return &call_fallback;
+    }
+};
+
+template<class R, class Self, class Key, class Args, class Seq, class... Ps>
+struct switch_dense_table;
+
+template<class R, class Self, class Key, class... Ts, std::size_t... Ns, class... Ps>
+struct switch_dense_table<R, Self, Key, holder<Ts...>, seq<Ns...>, Ps...>
+{
+    typedef switch_call<R, Self, Key, Ts...> caller;
+    typedef typename caller::function_type function_type;
+    typedef switch_entry<0, std::size_t(-1)> missing;
+
+    static constexpr std::intmax_t min_key = switch_min<Ps...>::value;
+
+    static constexpr function_type table[] =
+    {
+        caller::template get_function<switch_find<min_key + std::intmax_t(Ns), missing, Ps...>>(
+            std::integral_constant<bool, (switch_find<min_key + std::intmax_t(Ns), missing, Ps...>::index != missing::index)>()
+        )...
+    };
+
+    static R call(const Self& self, const Key& key, Ts&&... xs)
+    {
+        return (std::uintmax_t(std::intmax_t(key)) - std::uintmax_t(min_key) < sizeof...(Ns)) ?
+            table[std::uintmax_t(std::intmax_t(key)) - std::uintmax_t(min_key)](self, key, fit::forward<Ts>(xs)...) :
+            caller::call_fallback(self, key, fit::forward<Ts>(xs)...);
+    }
+};
+
+template<class R, class Self, class Key, class... Ts, std::size_t... Ns, class... Ps>
+constexpr typename switch_dense_table<R, Self, Key, holder<Ts...>, seq<Ns...>, Ps...>::function_type
+switch_dense_table<R, Self, Key, holder<Ts...>, seq<Ns...>, Ps...>::table[];
+
+template<class R, class Self, class Key, class Args, class Seq, class... Ps>
+struct switch_sparse_table;
+
+template<class R, class Self, class Key, class... Ts, std::size_t... Ns, class... Ps>
+struct switch_sparse_table<R, Self, Key, holder<Ts...>, seq<Ns...>, Ps...>
+{
+    typedef switch_call<R, Self, Key, Ts...> caller;
+    typedef typename caller::function_type function_type;
+
+    static constexpr std::intmax_t keys[] = { switch_nth<Ns, holder<Ps...>, Ps...>::key... };
+    static constexpr function_type table[] =
+    {
+        caller::template get_function<switch_nth<Ns, holder<Ps...>, Ps...>>(std::true_type())...
+    };
+
+    static R call(const Self& self, const Key& key, Ts&&... xs)
+    {
+        std::size_t first = 0;
+        std::size_t last = sizeof...(Ns);
+        while (first < last)
+        {
+            std::size_t middle = first + (last - first) / 2;
+            if (keys[middle] < std::intmax_t(key)) first = middle + 1;
+            else last = middle;
+        }
+        return (first < sizeof...(Ns) && keys[first] == std::intmax_t(key)) ?
+            table[first](self, key, fit::forward<Ts>(xs)...) :
+            caller::call_fallback(self, key, fit::forward<Ts>(xs)...);
+    }
+};
+
+template<class R, class Self, class Key, class... Ts, std::size_t... Ns, class... Ps>
+constexpr std::intmax_t switch_sparse_table<R, Self, Key, holder<Ts...>, seq<Ns...>, Ps...>::keys[];
+
+template<class R, class Self, class Key, class... Ts, std::size_t... Ns, class... Ps>
+constexpr typename switch_sparse_table<R, Self, Key, holder<Ts...>, seq<Ns...>, Ps...>::function_type
+switch_sparse_table<R, Self, Key, holder<Ts...>, seq<Ns...>, Ps...>::table[];
+
+template<class R, class Self, class Key, class Args>
+struct switch_empty_table;
+
+template<class R, class Self, class Key, class... Ts>
+struct switch_empty_table<R, Self, Key, holder<Ts...>>
+{
+    static R call(const Self& self, const Key& key, Ts&&... xs)
+    {
+        return switch_call<R, Self, Key, Ts...>::call_fallback(self, key, fit::forward<Ts>(xs)...);
+    }
+};
+
+template<class R, class Self, class Key, class Args, class... Ps>
+struct switch_dense
+: switch_dense_table<R, Self, Key, Args, typename gens<
+    std::size_t(switch_max<Ps...>::value - switch_min<Ps...>::value) + 1
+>::type, Ps...>
+{};
+
+template<class R, class Self, class Key, class Args, class... Ps>
+struct switch_sparse
+: switch_sparse_table<R, Self, Key, Args, typename gens<sizeof...(Ps)>::type, Ps...>
+{};
+
+template<class... Ps>
+struct switch_is_dense
+: std::integral_constant<bool, (
+    std::uintmax_t(switch_max<Ps...>::value) - std::uintmax_t(switch_min<Ps...>::value) < 2*sizeof...(Ps)
+)>
+{};
+
+template<>
+struct switch_is_dense<>
+: std::false_type
+{};
+
+template<class R, class Self, class Key, class Args, class... Ps>
+struct switch_table
+: std::conditional<(sizeof...(Ps) == 0),
+    switch_empty_table<R, Self, Key, Args>,
+    typename std::conditional<switch_is_dense<Ps...>::value,
+        switch_dense<R, Self, Key, Args, Ps...>,
+        switch_sparse<R, Self, Key, Args, Ps...>
+    >::type
+>::type
+{
+    static_assert(and_<std::integral_constant<bool, (switch_count<Ps::key, Ps...>::value == 1)>...>::value,
+        "Duplicate key used in switch_");
+};
+
+template<class Seq>
+struct switch_seq_size;
+
+template<std::size_t... Ns>
+struct switch_seq_size<seq<Ns...>>
+: std::integral_constant<std::size_t, sizeof...(Ns)>
+{};
+
+template<class T>
+struct switch_key
+: std::integral_constant<std::intmax_t, std::intmax_t(T::fit_switch_key::value)>
+{};
+
+template<class T>
+constexpr const T& switch_function(const T& x)
+{
+    return x;
+}
+
+template<class P, class F>
+constexpr const callable_base<F>& switch_function(const when_adaptor<P, F>& x)
+{
+    return x.base_function();
+}
+
+// The result of each case is only defined when it can be called with the
+// arguments, so the adaptor can be used in a SFINAE context
+template<class T, class Args, class=void>
+struct switch_case_result
+{};
+
+template<class T, class... Ts>
+struct switch_case_result<T, holder<Ts...>, typename holder<
+    decltype(switch_function(std::declval<const T&>())(std::declval<Ts>()...))
+>::type>
+{
+    typedef decltype(switch_function(std::declval<const T&>())(std::declval<Ts>()...)) type;
+};
+
+template<class Cases, class Args, class=void>
+struct switch_result
+{};
+
+template<class... Cases, class Args>
+struct switch_result<holder<Cases...>, Args, typename holder<
+    typename switch_case_result<Cases, Args>::type...
+>::type>
+: std::common_type<typename switch_case_result<Cases, Args>::type...>
+{};
+
+template<std::size_t I, class... Cases>
+struct switch_case_at;
+
+template<class C, class... Cs>
+struct switch_case_at<0, C, Cs...>
+{
+    typedef callable_base<C> type;
+};
+
+template<std::size_t I, class C, class... Cs>
+struct switch_case_at<I, C, Cs...>
+: switch_case_at<I-1, Cs...>
+{};
+
+template<class... Cases>
+struct switch_cases
+{};
+
+template<class C, class... Cs>
+struct switch_cases<C, Cs...>
+: compressed_pair<callable_base<C>, switch_cases<Cs...>>
+{
+    typedef compressed_pair<callable_base<C>, switch_cases<Cs...>> base_type;
+
+    FIT_INHERIT_DEFAULT(switch_cases, base_type)
+
+    template<class X, class... Xs, FIT_ENABLE_IF_CONVERTIBLE(X, callable_base<C>), FIT_ENABLE_IF_CONSTRUCTIBLE(switch_cases<Cs...>, Xs...)>
+    constexpr switch_cases(X&& x, Xs&&... xs)
+    : base_type(pair_rest_tag(), fit::forward<X>(x), fit::forward<Xs>(xs)...)
+    {}
+
+    template<class... Ts>
+    constexpr const callable_base<C>& get(std::integral_constant<std::size_t, 0>, Ts&&... xs) const
+    {
+        return this->first(xs...);
+    }
+
+    template<std::size_t I, class... Ts>
+    constexpr const typename switch_case_at<I, C, Cs...>::type& get(std::integral_constant<std::size_t, I>, Ts&&... xs) const
+    {
+        return this->second(xs...).get(std::integral_constant<std::size_t, I-1>(), xs...);
+    }
+};
+
+}
+
+template<class... Cases>
+struct switch_adaptor : detail::switch_cases<Cases...>
+{
+    typedef detail::switch_cases<Cases...> base_type;
+    typedef typename detail::switch_select<detail::is_switch_case, detail::seq<>, 0, Cases...>::type case_seq;
+    typedef typename detail::switch_select<detail::is_switch_when, detail::seq<>, 0, Cases...>::type when_seq;
+    typedef typename detail::switch_select<detail::is_switch_default, detail::seq<>, 0, Cases...>::type default_seq;
+
+    static_assert(detail::switch_seq_size<default_seq>::value <= 1,
+        "More than one default_ used in switch_");
+
+    FIT_INHERIT_CONSTRUCTOR(switch_adaptor, base_type);
+
+    template<std::size_t I, class... Ts>
+    constexpr const typename detail::switch_case_at<I, Cases...>::type& get_case(Ts&&... xs) const
+    {
+        return this->get(std::integral_constant<std::size_t, I>(), xs...);
+    }
+
+    template<class... Ts>
+    struct result
+    : detail::switch_result<detail::holder<Cases...>, detail::holder<Ts...>>
+    {};
+
+    template<class Key, class Seq, class... Ts>
+    struct table;
+
+    template<class Key, std::size_t... Is, class... Ts>
+    struct table<Key, detail::seq<Is...>, Ts...>
+    : detail::switch_table<typename result<Ts...>::type, switch_adaptor, Key, detail::holder<Ts...>,
+        detail::switch_entry<
+            detail::switch_key<typename detail::switch_case_at<Is, Cases...>::type>::value,
+            Is
+        >...
+    >
+    {};
+
+    template<class Key, class... Ts>
+    typename result<Ts...>::type operator()(const Key& key, Ts&&... xs) const
+    {
+        return table<Key, case_seq, Ts...>::call(*this, key, fit::forward<Ts>(xs)...);
+    }
+};
+
+FIT_DECLARE_STATIC_VAR(switch_, detail::make<switch_adaptor>);
+FIT_DECLARE_STATIC_VAR(when, detail::make<when_adaptor>);
+FIT_DECLARE_STATIC_VAR(default_, detail::make<default_adaptor>);
+
+} // namespace fit
+
+#endif
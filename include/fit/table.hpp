@@ -0,0 +1,112 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    table.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_TABLE_H
+#define FIT_GUARD_TABLE_H
+
+/// table
+/// =====
+/// 
+/// Description
+/// -----------
+/// 
+/// The `table` function calls the function with every index from `0` to
+/// `N-1` and stores the results in an array. The array is built in a
+/// constant expression when the function is `constexpr`, so the values are
+/// computed at compile time instead of at startup. Calling the table with an
+/// index returns a reference to the stored value, so it can be used like the
+/// function it was built from, for example with [`compose`](compose.md).
+/// 
+/// When the function is default constructible, the table is default
+/// constructible too, so it can be declared with
+/// [`FIT_STATIC_FUNCTION`](function.md). Then there is a single table for the
+/// whole program, which is initialized at compile time.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<std::size_t N, class F>
+///     constexpr table_adaptor<N, F> table(F f);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     assert(table<N>(f)(i) == f(i));
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * CopyConstructible
+/// 
+/// `N` must be greater than 0, and the index must be less than `N`.
+/// 
+/// Example
+/// -------
+/// 
+///     struct bit_reverse_f
+///     {
+///         constexpr unsigned char operator()(std::size_t i) const
+///         {
+///             return ((i & 1) << 7) | ((i & 2) << 5) | ((i & 4) << 3) | ((i & 8) << 1) |
+///                 ((i & 16) >> 1) | ((i & 32) >> 3) | ((i & 64) >> 5) | ((i & 128) >> 7);
+///         }
+///     };
+/// 
+///     FIT_STATIC_FUNCTION(bit_reverse) = fit::table<256>(bit_reverse_f());
+///     static_assert(bit_reverse(1) == 128, "Computed at compile time");
+/// 
+
+#include <fit/detail/seq.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace fit {
+
+template<std::size_t N, class F>
+struct table_adaptor
+{
+    static_assert(N > 0, "The table must have at least one element");
+
+    typedef typename std::decay<decltype(std::declval<const F&>()(std::declval<std::size_t>()))>::type value_type;
+
+    value_type data[N];
+
+    template<class G=F, class=typename std::enable_if<std::is_default_constructible<G>::value>::type>
+    constexpr table_adaptor() : table_adaptor(G(), typename detail::gens<N>::type())
+    {}
+
+    constexpr table_adaptor(const F& f) : table_adaptor(f, typename detail::gens<N>::type())
+    {}
+
+    constexpr std::size_t size() const
+    {
+        return N;
+    }
+
+    constexpr const value_type& operator()(std::size_t i) const
+    {
+        return data[i];
+    }
+
+private:
+    template<std::size_t... Ns>
+    constexpr table_adaptor(const F& f, detail::seq<Ns...>) : data{ f(Ns)... }
+    {}
+};
+
+template<std::size_t N, class F>
+constexpr table_adaptor<N, F> table(F f)
+{
+    return table_adaptor<N, F>(f);
+}
+
+} // namespace fit
+
+#endif
@@ -0,0 +1,235 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    thread_local.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_THREAD_LOCAL_H
+#define FIT_GUARD_THREAD_LOCAL_H
+
+/// thread_local_
+/// =============
+/// 
+/// Description
+/// -----------
+/// 
+/// The `thread_local_` function adaptor gives each thread its own copy of a
+/// function object, so a function with state, such as a random number
+/// generator or a function that reuses a buffer, can be called from several
+/// threads without a data race, and without a lock. Like
+/// [`mutable_`](mutable.md), the function is called as non-const.
+/// 
+/// The copy for a thread is made from the function the adaptor was built
+/// with the first time that thread calls it. The copies are kept in a small
+/// cache for each thread, which is searched without a lock. A lock is only
+/// taken when a thread makes its copy, and when the copy is destroyed.
+/// Copies of the adaptor share the same function, so they also share the
+/// copy of each thread.
+/// 
+/// An optional merge function can be given to collect the state of the
+/// copies. It is called with each copy before it is destroyed, which happens
+/// when the thread exits, or when the last copy of the adaptor is destroyed
+/// for the threads that are still running. The calls to the merge function
+/// are serialized, so it can update a shared total without a lock.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     thread_local_adaptor<F> thread_local_(F f);
+/// 
+///     template<class F, class Merge>
+///     thread_local_adaptor<F, Merge> thread_local_(F f, Merge merge);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     assert(thread_local_(f)(xs...) == f(xs...));
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * CopyConstructible
+/// 
+/// Merge must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// The function is copied from several threads at the same time, so copying
+/// it must not modify it. A copy must not be used by the thread after the
+/// last copy of the adaptor is destroyed.
+/// 
+/// Example
+/// -------
+/// 
+///     struct counter
+///     {
+///         int n = 0;
+///         void operator()()
+///         {
+///             n++;
+///         }
+///     };
+/// 
+///     int total = 0;
+///     {
+///         auto count = fit::thread_local_(counter(), [&](const counter& c) { total += c.n; });
+///         std::thread t([&] { for(int i=0;i<100;i++) count(); });
+///         for(int i=0;i<100;i++) count();
+///         t.join();
+///     }
+///     assert(total == 200);
+/// 
+
+#include <fit/fwd.hpp>
+#include <fit/detail/result_of.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/make.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace fit { namespace detail {
+
+struct thread_local_no_merge
+{
+    template<class T>
+    void operator()(const T&) const
+    {}
+};
+
+template<class F, class Merge>
+struct thread_local_state
+{
+    typedef typename std::conditional<std::is_void<Merge>::value, thread_local_no_merge, Merge>::type merge_type;
+
+    const F f;
+    merge_type merge;
+    std::mutex m;
+    // The copies of the threads that are still running
+    std::vector<std::unique_ptr<F>> instances;
+
+    thread_local_state(F x, merge_type y) : f(fit::move(x)), merge(fit::move(y))
+    {}
+
+    ~thread_local_state()
+    {
+        for (auto& x : instances) merge(*x);
+    }
+
+    thread_local_state(const thread_local_state&) = delete;
+    thread_local_state& operator=(const thread_local_state&) = delete;
+
+    F* clone()
+    {
+        std::unique_ptr<F> x(new F(f));
+        std::lock_guard<std::mutex> lock(m);
+        instances.push_back(fit::move(x));
+        return instances.back().get();
+    }
+
+    void retire(F* x)
+    {
+        std::lock_guard<std::mutex> lock(m);
+        auto it = std::find_if(instances.begin(), instances.end(), [&](const std::unique_ptr<F>& p)
+        {
+            return p.get() == x;
+        });
+        if (it == instances.end()) return;
+        merge(*x);
+        instances.erase(it);
+    }
+};
+
+// The copies of one thread, for every adaptor with the same types. An entry
+// is only valid while its state is alive, since another state can be created
+// at the same address after it is destroyed.
+template<class F, class Merge>
+struct thread_local_cache
+{
+    typedef thread_local_state<F, Merge> state_type;
+
+    struct entry
+    {
+        const state_type* key;
+        std::weak_ptr<state_type> state;
+        F* instance;
+    };
+
+    std::vector<entry> entries;
+
+    thread_local_cache()
+    {}
+
+    ~thread_local_cache()
+    {
+        for (entry& e : entries)
+        {
+            if (auto s = e.state.lock()) s->retire(e.instance);
+        }
+    }
+
+    thread_local_cache(const thread_local_cache&) = delete;
+    thread_local_cache& operator=(const thread_local_cache&) = delete;
+
+    F& get(const std::shared_ptr<state_type>& s)
+    {
+        for (entry& e : entries)
+        {
+            if (e.key == s.get() && !e.state.expired()) return *e.instance;
+        }
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [](const entry& e)
+        {
+            return e.state.expired();
+        }), entries.end());
+        entry e = { s.get(), s, s->clone() };
+        entries.push_back(e);
+        return *e.instance;
+    }
+};
+
+template<class F, class Merge>
+thread_local_cache<F, Merge>& get_thread_local_cache()
+{
+    static thread_local thread_local_cache<F, Merge> c;
+    return c;
+}
+
+}
+
+template<class F, class Merge>
+struct thread_local_adaptor
+{
+    typedef detail::thread_local_state<F, Merge> state_type;
+
+    std::shared_ptr<state_type> state;
+
+    thread_local_adaptor(F f, typename state_type::merge_type merge=typename state_type::merge_type())
+    : state(std::make_shared<state_type>(fit::move(f), fit::move(merge)))
+    {}
+
+    F& instance() const
+    {
+        return detail::get_thread_local_cache<F, Merge>().get(state);
+    }
+
+    FIT_RETURNS_CLASS(thread_local_adaptor);
+
+    template<class... Ts>
+    FIT_SFINAE_RESULT(F, id_<Ts>...)
+    operator()(Ts&&... xs) const FIT_SFINAE_RETURNS(FIT_CONST_THIS->instance()(fit::forward<Ts>(xs)...));
+};
+
+FIT_DECLARE_STATIC_VAR(thread_local_, detail::make<thread_local_adaptor>);
+
+} // namespace fit
+
+#endif
@@ -0,0 +1,144 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    thunk.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_THUNK_H
+#define FIT_GUARD_THUNK_H
+
+/// thunk
+/// =====
+/// 
+/// Description
+/// -----------
+/// 
+/// The `thunk` function adaptor calls a nullary function the first time it
+/// is called, and stores the result. Later calls return a reference to the
+/// stored result, without calling the function again. This is useful for
+/// values that are expensive to compute and may not be needed, such as a
+/// table built from the configuration. The arguments can be bound to the
+/// function with [`lazy`](lazy.md).
+/// 
+/// The thunk can be called from several threads at the same time. Only one
+/// thread calls the function, while the others wait for it to finish. Once
+/// the result is stored, a call only reads an atomic flag, without taking a
+/// lock. If the function throws an exception, nothing is stored, and the
+/// function is called again on the next call.
+/// 
+/// Copying a thunk copies the function, and the result if it is already
+/// stored.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     thunk_adaptor<F> thunk(F f);
+/// 
+/// Semantics
+/// ---------
+/// 
+///     assert(thunk(f)() == f());
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * CopyConstructible
+/// 
+/// The function must return a value that is not void, and the type of the
+/// value, after it is decayed, must be CopyConstructible.
+/// 
+/// Example
+/// -------
+/// 
+///     struct squares_f
+///     {
+///         std::vector<int> operator()(int n) const
+///         {
+///             std::vector<int> r;
+///             for(int i=0;i<n;i++) r.push_back(i*i);
+///             return r;
+///         }
+///     };
+/// 
+///     auto squares = fit::thunk(fit::lazy(squares_f())(1000));
+///     assert(squares()[10] == 100);
+///     assert(&squares() == &squares());
+/// 
+
+#include <fit/detail/make.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fit {
+
+template<class F>
+struct thunk_adaptor
+{
+    typedef typename std::decay<decltype(std::declval<const F&>()())>::type value_type;
+    static_assert(!std::is_void<value_type>::value, "The function must return a value");
+
+    thunk_adaptor(F x) : f(fit::move(x)), ready(false)
+    {}
+
+    thunk_adaptor(const thunk_adaptor& x) : f(x.f), ready(false)
+    {
+        if (x.ready.load(std::memory_order_acquire))
+        {
+            new (&data) value_type(x.get());
+            ready.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    thunk_adaptor& operator=(const thunk_adaptor&) = delete;
+
+    ~thunk_adaptor()
+    {
+        if (ready.load(std::memory_order_relaxed)) this->get().~value_type();
+    }
+
+    const value_type& operator()() const
+    {
+        if (!ready.load(std::memory_order_acquire)) this->init();
+        return this->get();
+    }
+
+    bool is_ready() const
+    {
+        return ready.load(std::memory_order_acquire);
+    }
+
+private:
+    F f;
+    mutable typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type data;
+    mutable std::atomic<bool> ready;
+    mutable std::mutex m;
+
+    const value_type& get() const
+    {
+        return *reinterpret_cast<const value_type*>(&data);
+    }
+
+    void init() const
+    {
+        std::lock_guard<std::mutex> lock(m);
+        if (ready.load(std::memory_order_relaxed)) return;
+        new (&data) value_type(f());
+        ready.store(true, std::memory_order_release);
+    }
+};
+
+FIT_DECLARE_STATIC_VAR(thunk, detail::make<thunk_adaptor>);
+
+} // namespace fit
+
+#endif
@@ -0,0 +1,371 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    trace.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_TRACE_H
+#define FIT_GUARD_TRACE_H
+
+/// trace
+/// =====
+/// 
+/// Description
+/// -----------
+/// 
+/// The `trace` function adaptor records a begin and an end event around
+/// every call to the function. The events are written to a buffer owned by
+/// the calling thread, without taking any locks. The `trace_write` and
+/// `trace_dump` functions move the events out of every buffer and write them
+/// in the trace event format, which can be loaded by `chrome://tracing` or
+/// Perfetto.
+/// 
+/// When no name is given, the name of the type of the function is used. Each
+/// buffer holds `FIT_TRACE_BUFFER_SIZE` events. When a buffer is full, new
+/// calls are not recorded until the events are written out, and the number
+/// of calls that were not recorded is written with the events.
+/// 
+/// When `FIT_TRACE` is defined to 0, nothing is recorded and the adaptor
+/// calls the function directly.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F>
+///     constexpr trace_adaptor<F> trace(F f);
+/// 
+///     template<class F>
+///     constexpr trace_adaptor<F> trace(F f, const char* name);
+/// 
+///     void trace_write(std::ostream& os);
+/// 
+///     bool trace_dump(const char* filename);
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// The name must be a string that lives for the whole program, such as a
+/// string literal.
+/// 
+/// Example
+/// -------
+/// 
+///     struct increment
+///     {
+///         template<class T>
+///         T operator()(T x) const
+///         {
+///             return x + 1;
+///         }
+///     };
+/// 
+///     auto f = fit::trace(increment(), "increment");
+///     assert(f(1) == 2);
+///     fit::trace_dump("trace.json");
+/// 
+/// flow_traced
+/// ===========
+/// 
+/// Description
+/// -----------
+/// 
+/// The `flow_traced` function adaptor is the same as [`flow`](flow.md),
+/// except that each function is traced, using the name of its type. This
+/// shows how long each stage of the pipeline takes.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class... Fs>
+///     constexpr flow_adaptor<trace_adaptor<Fs>...> flow_traced(Fs... fs);
+/// 
+/// Requirements
+/// ------------
+/// 
+/// Fs must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// Example
+/// -------
+/// 
+///     auto f = fit::flow_traced(increment(), increment());
+///     assert(f(1) == 3);
+/// 
+
+#ifndef FIT_TRACE
+#define FIT_TRACE 1
+#endif
+
+#ifndef FIT_TRACE_BUFFER_SIZE
+#define FIT_TRACE_BUFFER_SIZE 16384
+#endif
+
+#include <fit/flow.hpp>
+#include <fit/detail/callable_base.hpp>
+#include <fit/detail/named_adaptor.hpp>
+#include <fit/detail/delegate.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace fit { namespace detail {
+
+struct trace_event
+{
+    const char* name;
+    std::uint64_t ts;
+    char phase;
+};
+
+struct trace_thread_event
+{
+    trace_event event;
+    std::size_t tid;
+};
+
+struct trace_buffer;
+
+struct trace_registry
+{
+    std::mutex m;
+    std::vector<trace_buffer*> buffers;
+    // Events of the threads that have already exited
+    std::vector<trace_thread_event> retired;
+    std::uint64_t retired_dropped;
+    std::size_t next_tid;
+    std::chrono::steady_clock::time_point epoch;
+
+    trace_registry() : retired_dropped(0), next_tid(0), epoch(std::chrono::steady_clock::now())
+    {}
+};
+
+inline trace_registry& get_trace_registry()
+{
+    static trace_registry r;
+    return r;
+}
+
+// A ring buffer with a single producer, which is the thread that owns it. The
+// consumers are serialized by the lock of the registry.
+struct trace_buffer
+{
+    static_assert((FIT_TRACE_BUFFER_SIZE & (FIT_TRACE_BUFFER_SIZE - 1)) == 0, "The trace buffer size must be a power of two");
+    static const std::size_t capacity = FIT_TRACE_BUFFER_SIZE;
+
+    std::unique_ptr<trace_event[]> events;
+    std::atomic<std::size_t> head;
+    std::atomic<std::size_t> tail;
+    std::atomic<std::uint64_t> dropped;
+    // Number of begin events whose end event is still to be written, which
+    // always have space reserved for them
+    std::size_t depth;
+    std::size_t tid;
+    std::chrono::steady_clock::time_point epoch;
+
+    trace_buffer() : events(new trace_event[capacity]), head(0), tail(0), dropped(0), depth(0)
+    {
+        trace_registry& r = get_trace_registry();
+        std::lock_guard<std::mutex> lock(r.m);
+        tid = r.next_tid++;
+        epoch = r.epoch;
+        r.buffers.push_back(this);
+    }
+
+    ~trace_buffer()
+    {
+        trace_registry& r = get_trace_registry();
+        std::lock_guard<std::mutex> lock(r.m);
+        this->drain([&](const trace_event& e)
+        {
+            trace_thread_event x = { e, tid };
+            r.retired.push_back(x);
+        });
+        r.retired_dropped += dropped.load(std::memory_order_relaxed);
+        r.buffers.erase(std::remove(r.buffers.begin(), r.buffers.end(), this), r.buffers.end());
+    }
+
+    trace_buffer(const trace_buffer&) = delete;
+    trace_buffer& operator=(const trace_buffer&) = delete;
+
+    std::uint64_t now() const
+    {
+        auto d = std::chrono::steady_clock::now() - epoch;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    }
+
+    void push(const char* name, char phase)
+    {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        trace_event e = { name, this->now(), phase };
+        events[h & (capacity - 1)] = e;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    bool begin(const char* name)
+    {
+        std::size_t used = head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire);
+        if (capacity - used < depth + 2)
+        {
+            dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        depth++;
+        this->push(name, 'B');
+        return true;
+    }
+
+    void end(const char* name)
+    {
+        depth--;
+        this->push(name, 'E');
+    }
+
+    template<class F>
+    void drain(F f)
+    {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        std::size_t h = head.load(std::memory_order_acquire);
+        for (std::size_t i = t; i != h; i++) f(events[i & (capacity - 1)]);
+        tail.store(h, std::memory_order_release);
+    }
+};
+
+inline trace_buffer& get_trace_buffer()
+{
+    static thread_local trace_buffer b;
+    return b;
+}
+
+struct trace_scope
+{
+    const char* name;
+    bool recorded;
+
+    trace_scope(const char* n) : name(n), recorded(get_trace_buffer().begin(n))
+    {}
+
+    ~trace_scope()
+    {
+        if (recorded) get_trace_buffer().end(name);
+    }
+};
+
+inline void trace_write_event(std::ostream& os, const trace_thread_event& x, bool first)
+{
+    if (!first) os << ",";
+    os << "\n{\"name\": ";
+    write_json_string(os, x.event.name);
+    os << ", \"ph\": \"" << x.event.phase << "\""
+       << ", \"ts\": " << x.event.ts / 1000 << "."
+       << char('0' + x.event.ts / 100 % 10)
+       << char('0' + x.event.ts / 10 % 10)
+       << char('0' + x.event.ts % 10)
+       << ", \"pid\": 1, \"tid\": " << x.tid << "}";
+}
+
+}
+
+inline void trace_write(std::ostream& os)
+{
+    detail::trace_registry& r = detail::get_trace_registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    std::uint64_t dropped = r.retired_dropped;
+    bool first = true;
+    os << "{\"traceEvents\": [";
+    for (const detail::trace_thread_event& x : r.retired)
+    {
+        detail::trace_write_event(os, x, first);
+        first = false;
+    }
+    for (detail::trace_buffer* b : r.buffers)
+    {
+        b->drain([&](const detail::trace_event& e)
+        {
+            detail::trace_thread_event x = { e, b->tid };
+            detail::trace_write_event(os, x, first);
+            first = false;
+        });
+        dropped += b->dropped.load(std::memory_order_relaxed);
+    }
+    os << "\n], \"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped\": " << dropped << "}}\n";
+    r.retired.clear();
+}
+
+inline bool trace_dump(const char* filename)
+{
+    std::ofstream os(filename);
+    if (!os) return false;
+    trace_write(os);
+    return static_cast<bool>(os);
+}
+
+namespace detail {
+
+#if FIT_TRACE
+typedef trace_scope trace_call_scope;
+#else
+typedef void trace_call_scope;
+#endif
+
+}
+
+template<class F>
+struct trace_adaptor : detail::named_adaptor<F, detail::trace_call_scope>
+{
+    typedef detail::named_adaptor<F, detail::trace_call_scope> base_type;
+
+    FIT_INHERIT_DEFAULT(trace_adaptor, base_type)
+
+    FIT_INHERIT_CONSTRUCTOR(trace_adaptor, base_type);
+};
+
+namespace detail {
+
+struct trace_f
+{
+    template<class F>
+    constexpr trace_adaptor<F> operator()(F f) const
+    {
+        return trace_adaptor<F>(fit::move(f));
+    }
+
+    template<class F>
+    constexpr trace_adaptor<F> operator()(F f, const char* name) const
+    {
+        return trace_adaptor<F>(fit::move(f), name);
+    }
+};
+
+struct flow_traced_f
+{
+    template<class... Fs>
+    constexpr flow_adaptor<trace_adaptor<Fs>...> operator()(Fs... fs) const
+    {
+        return flow_adaptor<trace_adaptor<Fs>...>(trace_adaptor<Fs>(fit::move(fs))...);
+    }
+};
+
+}
+
+FIT_DECLARE_STATIC_VAR(trace, detail::trace_f);
+FIT_DECLARE_STATIC_VAR(flow_traced, detail::flow_traced_f);
+
+} // namespace fit
+
+#endif
@@ -71,7 +71,11 @@
 /// ===============
 /// 
 /// How to unpack a sequence can be defined by specializing `unpack_sequence`.
-/// By default, `std::tuple` can be used with unpack.
+/// By default, `std::tuple`, `std::pair`, `std::array`, built-in arrays and
+/// `std::integer_sequence`(when available) can be used with unpack. The
+/// elements of these sequences are passed directly to the function, without
+/// being copied into another sequence first. The elements of an
+/// `std::integer_sequence` are passed as `std::integral_constant`s.
 /// 
 /// Synopsis
 /// --------
@@ -93,8 +97,11 @@
 ///     };
 /// 
 
+#include <fit/fwd.hpp>
 #include <fit/returns.hpp>
 #include <tuple>
+#include <array>
+#include <utility>
 #include <fit/detail/seq.hpp>
 #include <fit/capture.hpp>
 #include <fit/always.hpp>
@@ -106,9 +113,17 @@
 #include <fit/detail/make.hpp>
 #include <fit/detail/static_const_var.hpp>
 
+#ifndef FIT_HAS_STD_INTEGER_SEQUENCE
+#if __cplusplus > 201103L
+#define FIT_HAS_STD_INTEGER_SEQUENCE 1
+#else
+#define FIT_HAS_STD_INTEGER_SEQUENCE 0
+#endif
+#endif
+
 namespace fit {
 
-template<class Sequence, class=void>
+template<class Sequence, class>
 struct unpack_sequence
 {
     typedef void not_unpackable;
@@ -286,6 +301,64 @@ struct unpack_sequence<std::tuple<Ts...>>
     );
 };
 
+namespace detail {
+
+template<class F, class Sequence, std::size_t... N>
+constexpr auto unpack_array(F&& f, Sequence&& s, seq<N...>) FIT_RETURNS
+(
+    f(std::get<N>(fit::forward<Sequence>(s))...)
+);
+
+template<class F, class Sequence, std::size_t... N>
+constexpr auto unpack_builtin_array(F&& f, Sequence&& s, seq<N...>) FIT_RETURNS
+(
+    f(fit::forward<Sequence>(s)[N]...)
+);
+
+}
+
+template<class T, class U>
+struct unpack_sequence<std::pair<T, U>>
+{
+    template<class F, class S>
+    constexpr static auto apply(F&& f, S&& p) FIT_RETURNS
+    (
+        f(fit::forward<S>(p).first, fit::forward<S>(p).second)
+    );
+};
+
+template<class T, std::size_t N>
+struct unpack_sequence<std::array<T, N>>
+{
+    template<class F, class S>
+    constexpr static auto apply(F&& f, S&& a) FIT_RETURNS
+    (
+        detail::unpack_array(fit::forward<F>(f), fit::forward<S>(a), typename detail::gens<N>::type())
+    );
+};
+
+template<class T, std::size_t N>
+struct unpack_sequence<T[N]>
+{
+    template<class F, class S>
+    constexpr static auto apply(F&& f, S&& a) FIT_RETURNS
+    (
+        detail::unpack_builtin_array(fit::forward<F>(f), fit::forward<S>(a), typename detail::gens<N>::type())
+    );
+};
+
+#if FIT_HAS_STD_INTEGER_SEQUENCE
+template<class T, T... Ns>
+struct unpack_sequence<std::integer_sequence<T, Ns...>>
+{
+    template<class F, class S>
+    constexpr static auto apply(F&& f, S&&) FIT_RETURNS
+    (
+        f(std::integral_constant<T, Ns>()...)
+    );
+};
+#endif
+
 template<class T, class... Ts>
 struct unpack_sequence<detail::pack_base<T, Ts...>>
 {
@@ -0,0 +1,634 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    view.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_VIEW_H
+#define FIT_GUARD_VIEW_H
+
+/// view
+/// ====
+/// 
+/// Description
+/// -----------
+/// 
+/// The view functions build lazy views of a range, which can be chained with
+/// `|` since they are [`pipable`](pipable.md). A view doesn't copy the
+/// elements or allocate memory. Instead, its iterators call the next stage
+/// as the range is iterated, so a chain of views is iterated in a single
+/// loop. A range that is an lvalue is stored by reference, and a range that
+/// is an rvalue, such as another view, is moved into the view.
+/// 
+/// * `transform(r, f)` calls `f` with each element.
+/// * `filter(r, p)` skips the elements for which `p` returns false.
+/// * `take(r, n)` stops after the first `n` elements.
+/// * `chunk(r, n)` splits the range into ranges of `n` elements, where the
+///   last one can be shorter. When `n` is zero, there are no chunks.
+/// * `zip(r1, r2, ...)` iterates several ranges together, as a `std::tuple`
+///   of the elements, and stops at the end of the shortest one.
+/// * `enumerate(r)` pairs each element with its index, as a `std::pair`.
+/// 
+/// The functions given to `transform` and `filter` can be any function
+/// object, including the adaptors of this library, and they are called as
+/// const.
+/// 
+/// The views are input ranges, so they should be iterated once. `chunk`
+/// needs a forward range, since each chunk is iterated separately.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class Range, class F>
+///     transform_view<Range, F> transform(Range&& r, F f);
+/// 
+///     template<class Range, class Predicate>
+///     filter_view<Range, Predicate> filter(Range&& r, Predicate p);
+/// 
+///     template<class Range>
+///     take_view<Range> take(Range&& r, std::size_t n);
+/// 
+///     template<class Range>
+///     chunk_view<Range> chunk(Range&& r, std::size_t n);
+/// 
+///     template<class Range1, class Range2, class... Ranges>
+///     zip_view<Range1, Range2, Ranges...> zip(Range1&& r1, Range2&& r2, Ranges&&... rs);
+/// 
+///     template<class Range>
+///     enumerate_view<Range> enumerate(Range&& r);
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// Predicate must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// * MoveConstructible
+/// 
+/// Example
+/// -------
+/// 
+///     std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7, 8 };
+///     int sum = 0;
+///     for (int x : v | fit::filter(is_even()) | fit::transform(square()) | fit::take(3)) sum += x;
+///     assert(sum == 4 + 16 + 36);
+/// 
+
+#include <fit/pipable.hpp>
+#include <fit/detail/forward.hpp>
+#include <fit/detail/holder.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/seq.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fit { namespace detail {
+
+template<class Range, class=void>
+struct view_iterator
+{};
+
+template<class Range>
+struct view_iterator<Range, typename holder<
+    decltype(std::begin(std::declval<Range&>()))
+>::type>
+{
+    typedef decltype(std::begin(std::declval<Range&>())) type;
+};
+
+template<class Iterator>
+struct view_reference
+{
+    typedef decltype(*std::declval<Iterator&>()) type;
+};
+
+template<class Reference>
+struct view_iterator_base
+{
+    typedef std::input_iterator_tag iterator_category;
+    typedef typename std::decay<Reference>::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef Reference reference;
+};
+
+template<class Iterator>
+struct iterator_view
+{
+    Iterator first;
+    Iterator last;
+
+    iterator_view(Iterator f, Iterator l) : first(f), last(l)
+    {}
+
+    Iterator begin() const
+    {
+        return first;
+    }
+
+    Iterator end() const
+    {
+        return last;
+    }
+};
+
+}
+
+template<class Range, class F>
+struct transform_view
+{
+    typedef typename detail::view_iterator<Range>::type base_iterator;
+    typedef decltype(std::declval<const F&>()(*std::declval<base_iterator&>())) reference;
+
+    struct iterator : detail::view_iterator_base<reference>
+    {
+        base_iterator it;
+        const F* f;
+
+        iterator(base_iterator i, const F* fp) : it(i), f(fp)
+        {}
+
+        reference operator*() const
+        {
+            return (*f)(*it);
+        }
+
+        iterator& operator++()
+        {
+            ++it;
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++it;
+        }
+
+        bool operator==(const iterator& x) const
+        {
+            return it == x.it;
+        }
+
+        bool operator!=(const iterator& x) const
+        {
+            return !(*this == x);
+        }
+    };
+
+    Range range;
+    F f;
+
+    template<class R, class G>
+    transform_view(R&& r, G&& g) : range(fit::forward<R>(r)), f(fit::forward<G>(g))
+    {}
+
+    iterator begin()
+    {
+        return iterator(std::begin(range), &f);
+    }
+
+    iterator end()
+    {
+        return iterator(std::end(range), &f);
+    }
+};
+
+template<class Range, class Predicate>
+struct filter_view
+{
+    typedef typename detail::view_iterator<Range>::type base_iterator;
+    typedef typename detail::view_reference<base_iterator>::type reference;
+
+    struct iterator : detail::view_iterator_base<reference>
+    {
+        base_iterator it;
+        base_iterator last;
+        const Predicate* p;
+
+        iterator(base_iterator i, base_iterator l, const Predicate* pp) : it(i), last(l), p(pp)
+        {
+            this->skip();
+        }
+
+        void skip()
+        {
+            while (it != last && !(*p)(*it)) ++it;
+        }
+
+        reference operator*() const
+        {
+            return *it;
+        }
+
+        iterator& operator++()
+        {
+            ++it;
+            this->skip();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(const iterator& x) const
+        {
+            return it == x.it;
+        }
+
+        bool operator!=(const iterator& x) const
+        {
+            return !(*this == x);
+        }
+    };
+
+    Range range;
+    Predicate p;
+
+    template<class R, class P>
+    filter_view(R&& r, P&& pp) : range(fit::forward<R>(r)), p(fit::forward<P>(pp))
+    {}
+
+    iterator begin()
+    {
+        return iterator(std::begin(range), std::end(range), &p);
+    }
+
+    iterator end()
+    {
+        return iterator(std::end(range), std::end(range), &p);
+    }
+};
+
+template<class Range>
+struct take_view
+{
+    typedef typename detail::view_iterator<Range>::type base_iterator;
+    typedef typename detail::view_reference<base_iterator>::type reference;
+
+    struct iterator : detail::view_iterator_base<reference>
+    {
+        base_iterator it;
+        base_iterator last;
+        std::size_t n;
+
+        iterator(base_iterator i, base_iterator l, std::size_t np) : it(i), last(l), n(np)
+        {}
+
+        bool done() const
+        {
+            return n == 0 || it == last;
+        }
+
+        reference operator*() const
+        {
+            return *it;
+        }
+
+        // The range is not advanced past the last element that is taken, so
+        // the next elements are not computed
+        iterator& operator++()
+        {
+            if (--n > 0) ++it;
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(const iterator& x) const
+        {
+            return this->done() ? x.done() : (!x.done() && it == x.it);
+        }
+
+        bool operator!=(const iterator& x) const
+        {
+            return !(*this == x);
+        }
+    };
+
+    Range range;
+    std::size_t n;
+
+    template<class R>
+    take_view(R&& r, std::size_t np) : range(fit::forward<R>(r)), n(np)
+    {}
+
+    iterator begin()
+    {
+        return iterator(std::begin(range), std::end(range), n);
+    }
+
+    iterator end()
+    {
+        return iterator(std::end(range), std::end(range), 0);
+    }
+};
+
+template<class Range>
+struct chunk_view
+{
+    typedef typename detail::view_iterator<Range>::type base_iterator;
+    typedef detail::iterator_view<base_iterator> reference;
+
+    struct iterator : detail::view_iterator_base<reference>
+    {
+        base_iterator it;
+        base_iterator next;
+        base_iterator last;
+        std::size_t n;
+
+        iterator(base_iterator i, base_iterator l, std::size_t np) : it(i), next(i), last(l), n(np)
+        {
+            this->advance();
+        }
+
+        void advance()
+        {
+            next = it;
+            for (std::size_t i = 0; i < n && next != last; i++) ++next;
+        }
+
+        reference operator*() const
+        {
+            return reference(it, next);
+        }
+
+        iterator& operator++()
+        {
+            it = next;
+            this->advance();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(const iterator& x) const
+        {
+            return it == x.it;
+        }
+
+        bool operator!=(const iterator& x) const
+        {
+            return !(*this == x);
+        }
+    };
+
+    Range range;
+    std::size_t n;
+
+    template<class R>
+    chunk_view(R&& r, std::size_t np) : range(fit::forward<R>(r)), n(np)
+    {}
+
+    // Chunks of zero elements would never reach the end, so the view is empty
+    iterator begin()
+    {
+        return iterator(n == 0 ? std::end(range) : std::begin(range), std::end(range), n);
+    }
+
+    iterator end()
+    {
+        return iterator(std::end(range), std::end(range), n);
+    }
+};
+
+template<class... Ranges>
+struct zip_view
+{
+    typedef std::tuple<typename detail::view_iterator<Ranges>::type...> base_iterators;
+    typedef std::tuple<typename detail::view_reference<typename detail::view_iterator<Ranges>::type>::type...> reference;
+    typedef typename detail::gens<sizeof...(Ranges)>::type indices;
+
+    struct iterator : detail::view_iterator_base<reference>
+    {
+        base_iterators its;
+        base_iterators lasts;
+
+        iterator(base_iterators i, base_iterators l) : its(i), lasts(l)
+        {}
+
+        template<std::size_t... Ns>
+        bool done(detail::seq<Ns...>) const
+        {
+            bool ends[] = { false, (std::get<Ns>(its) == std::get<Ns>(lasts))... };
+            for (bool x : ends) if (x) return true;
+            return false;
+        }
+
+        template<std::size_t... Ns>
+        reference get(detail::seq<Ns...>) const
+        {
+            return reference(*std::get<Ns>(its)...);
+        }
+
+        template<std::size_t... Ns>
+        void increment(detail::seq<Ns...>)
+        {
+            int x[] = { 0, (++std::get<Ns>(its), 0)... };
+            (void)x;
+        }
+
+        reference operator*() const
+        {
+            return this->get(indices());
+        }
+
+        iterator& operator++()
+        {
+            this->increment(indices());
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        // Stops at the end of the shortest range
+        bool operator==(const iterator& x) const
+        {
+            return this->done(indices()) ? x.done(indices()) : (!x.done(indices()) && its == x.its);
+        }
+
+        bool operator!=(const iterator& x) const
+        {
+            return !(*this == x);
+        }
+    };
+
+    std::tuple<Ranges...> ranges;
+
+    template<class... Rs>
+    zip_view(Rs&&... rs) : ranges(fit::forward<Rs>(rs)...)
+    {}
+
+    template<std::size_t... Ns>
+    base_iterators begins(detail::seq<Ns...>)
+    {
+        return base_iterators(std::begin(std::get<Ns>(ranges))...);
+    }
+
+    template<std::size_t... Ns>
+    base_iterators ends(detail::seq<Ns...>)
+    {
+        return base_iterators(std::end(std::get<Ns>(ranges))...);
+    }
+
+    iterator begin()
+    {
+        return iterator(this->begins(indices()), this->ends(indices()));
+    }
+
+    iterator end()
+    {
+        return iterator(this->ends(indices()), this->ends(indices()));
+    }
+};
+
+template<class Range>
+struct enumerate_view
+{
+    typedef typename detail::view_iterator<Range>::type base_iterator;
+    typedef std::pair<std::size_t, typename detail::view_reference<base_iterator>::type> reference;
+
+    struct iterator : detail::view_iterator_base<reference>
+    {
+        base_iterator it;
+        std::size_t i;
+
+        iterator(base_iterator x, std::size_t ip) : it(x), i(ip)
+        {}
+
+        reference operator*() const
+        {
+            return reference(i, *it);
+        }
+
+        iterator& operator++()
+        {
+            ++it;
+            ++i;
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(const iterator& x) const
+        {
+            return it == x.it;
+        }
+
+        bool operator!=(const iterator& x) const
+        {
+            return !(*this == x);
+        }
+    };
+
+    Range range;
+
+    template<class R>
+    enumerate_view(R&& r) : range(fit::forward<R>(r))
+    {}
+
+    iterator begin()
+    {
+        return iterator(std::begin(range), 0);
+    }
+
+    iterator end()
+    {
+        return iterator(std::end(range), 0);
+    }
+};
+
+namespace detail {
+
+struct transform_f
+{
+    template<class Range, class F, class=typename view_iterator<Range>::type>
+    transform_view<Range, F> operator()(Range&& r, F f) const
+    {
+        return transform_view<Range, F>(fit::forward<Range>(r), fit::move(f));
+    }
+};
+
+struct filter_f
+{
+    template<class Range, class Predicate, class=typename view_iterator<Range>::type>
+    filter_view<Range, Predicate> operator()(Range&& r, Predicate p) const
+    {
+        return filter_view<Range, Predicate>(fit::forward<Range>(r), fit::move(p));
+    }
+};
+
+struct take_f
+{
+    template<class Range, class=typename view_iterator<Range>::type>
+    take_view<Range> operator()(Range&& r, std::size_t n) const
+    {
+        return take_view<Range>(fit::forward<Range>(r), n);
+    }
+};
+
+struct chunk_f
+{
+    template<class Range, class=typename view_iterator<Range>::type>
+    chunk_view<Range> operator()(Range&& r, std::size_t n) const
+    {
+        return chunk_view<Range>(fit::forward<Range>(r), n);
+    }
+};
+
+// Two ranges are needed, so `zip(r)` is a pipe closure
+struct zip_f
+{
+    template<class Range1, class Range2, class... Ranges,
+        class=typename view_iterator<Range1>::type,
+        class=typename view_iterator<Range2>::type>
+    zip_view<Range1, Range2, Ranges...> operator()(Range1&& r1, Range2&& r2, Ranges&&... rs) const
+    {
+        return zip_view<Range1, Range2, Ranges...>(fit::forward<Range1>(r1), fit::forward<Range2>(r2), fit::forward<Ranges>(rs)...);
+    }
+};
+
+struct enumerate_f
+{
+    template<class Range, class=typename view_iterator<Range>::type>
+    enumerate_view<Range> operator()(Range&& r) const
+    {
+        return enumerate_view<Range>(fit::forward<Range>(r));
+    }
+};
+
+}
+
+FIT_DECLARE_STATIC_VAR(transform, pipable_adaptor<detail::transform_f>);
+FIT_DECLARE_STATIC_VAR(filter, pipable_adaptor<detail::filter_f>);
+FIT_DECLARE_STATIC_VAR(take, pipable_adaptor<detail::take_f>);
+FIT_DECLARE_STATIC_VAR(chunk, pipable_adaptor<detail::chunk_f>);
+FIT_DECLARE_STATIC_VAR(zip, pipable_adaptor<detail::zip_f>);
+FIT_DECLARE_STATIC_VAR(enumerate, pipable_adaptor<detail::enumerate_f>);
+
+} // namespace fit
+
+#endif
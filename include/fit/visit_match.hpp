@@ -0,0 +1,314 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    visit_match.h
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#ifndef FIT_GUARD_VISIT_MATCH_H
+#define FIT_GUARD_VISIT_MATCH_H
+
+/// visit_match
+/// ===========
+/// 
+/// Description
+/// -----------
+/// 
+/// The `visit_match` function calls a function with the currently active
+/// alternative of each variant passed to it. It is intended to be used with
+/// the overload set built by [`match`](match.md), but any function object
+/// that can be called with every combination of alternatives can be used.
+/// 
+/// Instead of dispatching recursively, a single table of function pointers
+/// is built at compile time for all of the combinations of alternatives.
+/// When more than one variant is passed, the table is flattened, so the
+/// dispatch is always one index computation and one indirect call.
+/// 
+/// The result type is the common type of the results of every combination.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class F, class... Variants>
+///     constexpr auto visit_match(F&& f, Variants&&... vs);
+/// 
+/// Requirements
+/// ------------
+/// 
+/// F must be:
+/// 
+/// * [Callable](concepts.md#callable)
+/// 
+/// Each of the `Variants` must have a specialization of `variant_traits`.
+/// 
+/// Example
+/// -------
+/// 
+///     struct int_class
+///     {
+///         int operator()(int) const
+///         {
+///             return 1;
+///         }
+///     };
+/// 
+///     struct string_class
+///     {
+///         int operator()(const std::string&) const
+///         {
+///             return 2;
+///         }
+///     };
+/// 
+///     std::variant<int, std::string> v = std::string("hello");
+///     assert(fit::visit_match(fit::match(int_class(), string_class()), v) == 2);
+/// 
+/// variant_traits
+/// ==============
+/// 
+/// How to visit a variant can be defined by specializing `variant_traits`.
+/// The specialization provides the number of alternatives, the index of the
+/// active alternative and access to an alternative by index. The index must
+/// be less than the number of alternatives, so a variant without a value
+/// should throw from `index`. By default, `std::variant` can be used with
+/// `visit_match`, when it is available, and a `std::variant` that is
+/// valueless by exception throws `std::bad_variant_access`, like
+/// `std::visit`.
+/// 
+/// Synopsis
+/// --------
+/// 
+///     template<class Variant, class=void>
+///     struct variant_traits;
+/// 
+/// Example
+/// -------
+/// 
+///     template<>
+///     struct variant_traits<int_or_float>
+///     {
+///         typedef std::integral_constant<std::size_t, 2> size;
+/// 
+///         static constexpr std::size_t index(const int_or_float& v)
+///         {
+///             return v.is_float ? 1 : 0;
+///         }
+/// 
+///         template<std::size_t I, class V>
+///         constexpr static auto get(V&& v) FIT_RETURNS
+///         (
+///             v.template get<I>()
+///         );
+///     };
+/// 
+
+#include <fit/fwd.hpp>
+#include <fit/returns.hpp>
+#include <fit/detail/seq.hpp>
+#include <fit/detail/and.hpp>
+#include <fit/detail/holder.hpp>
+#include <fit/detail/forward.hpp>
+#include <fit/detail/static_const_var.hpp>
+#include <type_traits>
+
+#ifndef FIT_HAS_STD_VARIANT
+#if defined(__has_include) && __cplusplus > 201402L
+#if __has_include(<variant>)
+#define FIT_HAS_STD_VARIANT 1
+#else
+#define FIT_HAS_STD_VARIANT 0
+#endif
+#else
+#define FIT_HAS_STD_VARIANT 0
+#endif
+#endif
+
+#if FIT_HAS_STD_VARIANT
+#include <variant>
+#endif
+
+namespace fit {
+
+template<class Variant, class>
+struct variant_traits
+{
+    typedef void not_visitable;
+};
+
+#if FIT_HAS_STD_VARIANT
+template<class... Ts>
+struct variant_traits<std::variant<Ts...>>
+{
+    typedef std::integral_constant<std::size_t, sizeof...(Ts)> size;
+
+    static constexpr std::size_t index(const std::variant<Ts...>& v)
+    {
+        return v.valueless_by_exception() ? throw std::bad_variant_access() : v.index();
+    }
+
+    template<std::size_t I, class V>
+    constexpr static auto get(V&& v) FIT_RETURNS
+    (
+        std::get<I>(fit::forward<V>(v))
+    );
+};
+#endif
+
+namespace detail {
+
+template<class Variant, class=void>
+struct is_visitable_impl
+: std::true_type
+{};
+
+template<class Variant>
+struct is_visitable_impl<Variant, typename detail::holder<
+    typename variant_traits<Variant>::not_visitable
+>::type>
+: std::false_type
+{};
+
+}
+
+template<class Variant>
+struct is_visitable
+: detail::is_visitable_impl<
+    typename std::remove_cv<typename std::remove_reference<Variant>::type>::type
+>
+{};
+
+namespace detail {
+
+template<class V>
+struct variant_traits_of
+: variant_traits<typename std::remove_cv<typename std::remove_reference<V>::type>::type>
+{};
+
+template<std::size_t... Ns>
+struct visit_product
+: std::integral_constant<std::size_t, 1>
+{};
+
+template<std::size_t N, std::size_t... Ns>
+struct visit_product<N, Ns...>
+: std::integral_constant<std::size_t, N * visit_product<Ns...>::value>
+{};
+
+// The stride of the Jth variant in the flattened table
+template<std::size_t J, std::size_t... Sizes>
+struct visit_stride;
+
+template<std::size_t Size, std::size_t... Sizes>
+struct visit_stride<0, Size, Sizes...>
+: visit_product<Sizes...>
+{};
+
+template<std::size_t J, std::size_t Size, std::size_t... Sizes>
+struct visit_stride<J, Size, Sizes...>
+: visit_stride<J-1, Sizes...>
+{};
+
+template<std::size_t N, std::size_t J, std::size_t Size, std::size_t... Sizes>
+struct visit_alternative
+: std::integral_constant<std::size_t, (N / visit_stride<J, Sizes...>::value) % Size>
+{};
+
+constexpr std::size_t visit_flatten(std::size_t n)
+{
+    return n;
+}
+
+template<class V, class... Vs>
+constexpr std::size_t visit_flatten(std::size_t n, const V& v, const Vs&... vs)
+{
+    return visit_flatten(n * variant_traits_of<V>::size::value + variant_traits_of<V>::index(v), vs...);
+}
+
+template<std::size_t N, class JSeq, class... Vs>
+struct visit_entry;
+
+template<std::size_t N, std::size_t... Js, class... Vs>
+struct visit_entry<N, seq<Js...>, Vs...>
+{
+    template<class F>
+    static constexpr auto apply(const F& f, Vs&&... vs) FIT_RETURNS
+    (
+        f(variant_traits_of<Vs>::template get<
+            visit_alternative<N, Js, variant_traits_of<Vs>::size::value, variant_traits_of<Vs>::size::value...>::value
+        >(fit::forward<Vs>(vs))...)
+    );
+
+    template<class R, class F>
+    static constexpr R call(const F& f, Vs&&... vs)
+    {
+        return static_cast<R>(apply(f, fit::forward<Vs>(vs)...));
+    }
+};
+
+template<class... Vs>
+struct visit_seq_of
+: gens<visit_product<variant_traits_of<Vs>::size::value...>::value>
+{};
+
+// The result type is only defined when the function can be called with
+// every combination of alternatives, so visit_match can be used in a
+// SFINAE context
+template<class Enable, class F, class NSeq, class... Vs>
+struct visit_result_impl
+{};
+
+template<class F, std::size_t... Ns, class... Vs>
+struct visit_result_impl<typename holder<
+    decltype(visit_entry<Ns, typename gens<sizeof...(Vs)>::type, Vs...>::apply(std::declval<const F&>(), std::declval<Vs>()...))...
+>::type, F, seq<Ns...>, Vs...>
+: std::common_type<
+    decltype(visit_entry<Ns, typename gens<sizeof...(Vs)>::type, Vs...>::apply(std::declval<const F&>(), std::declval<Vs>()...))...
+>
+{};
+
+template<class F, class... Vs>
+struct visit_result
+: visit_result_impl<void, F, typename visit_seq_of<Vs...>::type, Vs...>
+{};
+
+template<class R, class F, class NSeq, class... Vs>
+struct visit_table;
+
+template<class R, class F, std::size_t... Ns, class... Vs>
+struct visit_table<R, F, seq<Ns...>, Vs...>
+{
+    typedef typename gens<sizeof...(Vs)>::type variant_seq;
+
+    typedef R(*function_type)(const F&, Vs&&...);
+
+    static constexpr function_type value[] = { &visit_entry<Ns, variant_seq, Vs...>::template call<R, F>... };
+};
+
+template<class R, class F, std::size_t... Ns, class... Vs>
+constexpr typename visit_table<R, F, seq<Ns...>, Vs...>::function_type visit_table<R, F, seq<Ns...>, Vs...>::value[];
+
+template<class R, class F, class... Vs>
+struct visit_table_of
+: visit_table<R, F, typename visit_seq_of<Vs...>::type, Vs...>
+{};
+
+struct visit_match_f
+{
+    template<class F, class V, class... Vs, class=typename std::enable_if<(and_<
+        is_visitable<V>, is_visitable<Vs>...
+    >::value)>::type, class R=typename visit_result<F, V, Vs...>::type>
+    constexpr R operator()(const F& f, V&& v, Vs&&... vs) const
+    {
+        return visit_table_of<R, F, V, Vs...>::value[visit_flatten(0, v, vs...)](
+            f, fit::forward<V>(v), fit::forward<Vs>(vs)...
+        );
+    }
+};
+
+}
+
+FIT_DECLARE_STATIC_VAR(visit_match, detail::visit_match_f);
+
+} // namespace fit
+
+#endif
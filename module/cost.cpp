@@ -0,0 +1,52 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    cost.cpp
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+// The source compiled by the module_cost target, once with the headers and
+// once with the module, to compare the time it takes to compile each. The
+// macros header only defines macros, so it costs the same in both modes.
+#include <fit/macros.hpp>
+#if FIT_COST_IMPORT
+import fit;
+#else
+#include <fit/always.hpp>
+#include <fit/apply.hpp>
+#include <fit/capture.hpp>
+#include <fit/compose.hpp>
+#include <fit/conditional.hpp>
+#include <fit/fix.hpp>
+#include <fit/flow.hpp>
+#include <fit/function.hpp>
+#include <fit/infix.hpp>
+#include <fit/lazy.hpp>
+#include <fit/match.hpp>
+#include <fit/pack.hpp>
+#include <fit/partial.hpp>
+#include <fit/pipable.hpp>
+#include <fit/placeholders.hpp>
+#include <fit/reveal.hpp>
+#include <fit/switch.hpp>
+#include <fit/unpack.hpp>
+#endif
+
+struct sum_f
+{
+    template<class T, class U>
+    constexpr auto operator()(T x, U y) const FIT_RETURNS(x + y);
+};
+
+FIT_STATIC_FUNCTION(sum) = fit::partial(sum_f());
+
+int fit_cost_function(int x)
+{
+    auto f = fit::flow(
+        fit::_1 * 2, 
+        sum(1), 
+        fit::conditional(fit::_1 + 1, fit::always(0))
+    );
+    auto p = fit::pack(x, f(x));
+    return p(fit::compose(sum(x), sum_f()));
+}
@@ -0,0 +1,217 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    fit-adaptors.cppm
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+module;
+
+#include <fit/alias.hpp>
+#include <fit/always.hpp>
+#include <fit/apply.hpp>
+#include <fit/apply_eval.hpp>
+#include <fit/arg.hpp>
+#include <fit/associative.hpp>
+#include <fit/bounded.hpp>
+#include <fit/by.hpp>
+#include <fit/capture.hpp>
+#include <fit/combine.hpp>
+#include <fit/compose.hpp>
+#include <fit/compress.hpp>
+#include <fit/conditional.hpp>
+#include <fit/construct.hpp>
+#include <fit/decay.hpp>
+#include <fit/decorate.hpp>
+#include <fit/eval.hpp>
+#include <fit/fix.hpp>
+#include <fit/flip.hpp>
+#include <fit/flow.hpp>
+#include <fit/identity.hpp>
+#include <fit/if.hpp>
+#include <fit/implicit.hpp>
+#include <fit/indirect.hpp>
+#include <fit/infix.hpp>
+#include <fit/is_callable.hpp>
+#include <fit/lazy.hpp>
+#include <fit/limit.hpp>
+#include <fit/match.hpp>
+#include <fit/mutable.hpp>
+#include <fit/partial.hpp>
+#include <fit/pipable.hpp>
+#include <fit/profile.hpp>
+#include <fit/protect.hpp>
+#include <fit/reduce.hpp>
+#include <fit/repeat.hpp>
+#include <fit/repeat_while.hpp>
+#include <fit/result.hpp>
+#include <fit/reveal.hpp>
+#include <fit/reverse_compress.hpp>
+#include <fit/rotate.hpp>
+#include <fit/shared.hpp>
+#include <fit/static.hpp>
+#include <fit/switch.hpp>
+#include <fit/table.hpp>
+#include <fit/tap.hpp>
+#include <fit/thread_local.hpp>
+#include <fit/thunk.hpp>
+#include <fit/trace.hpp>
+#include <fit/unpack.hpp>
+#include <fit/view.hpp>
+#include <fit/visit_match.hpp>
+
+export module fit:adaptors;
+
+export namespace fit {
+
+// Function objects
+using fit::always;
+using fit::always_ref;
+using fit::apply;
+using fit::apply_eval;
+using fit::arg;
+using fit::arg_c;
+using fit::associative;
+using fit::bounded;
+using fit::by;
+using fit::capture;
+using fit::capture_forward;
+using fit::capture_decay;
+using fit::case_;
+using fit::chunk;
+using fit::combine;
+using fit::compose;
+using fit::compress;
+using fit::conditional;
+using fit::construct;
+using fit::construct_meta;
+using fit::decay;
+using fit::decorate;
+using fit::default_;
+using fit::deterministic_reduce;
+using fit::enumerate;
+using fit::eval;
+using fit::filter;
+using fit::fix;
+using fit::flip;
+using fit::flow;
+using fit::flow_traced;
+using fit::identity;
+using fit::if_;
+using fit::if_c;
+using fit::indirect;
+using fit::infix;
+using fit::lazy;
+using fit::limit;
+using fit::limit_c;
+using fit::local_shared;
+using fit::match;
+using fit::mutable_;
+using fit::partial;
+using fit::pipable;
+using fit::profile;
+using fit::profile_snapshot;
+using fit::profile_reset;
+using fit::profile_write;
+using fit::profile_dump;
+using fit::protect;
+using fit::reduce;
+using fit::repeat;
+using fit::repeat_while;
+using fit::result;
+using fit::reveal;
+using fit::reverse_compress;
+using fit::rotate;
+using fit::shared;
+using fit::switch_;
+using fit::table;
+using fit::take;
+using fit::tap;
+using fit::thread_local_;
+using fit::thunk;
+using fit::trace;
+using fit::trace_write;
+using fit::trace_dump;
+using fit::transform;
+using fit::unpack;
+using fit::visit_match;
+using fit::when;
+using fit::zip;
+
+// Adaptors
+using fit::associative_adaptor;
+using fit::by_adaptor;
+using fit::case_adaptor;
+using fit::combine_adaptor;
+using fit::compose_adaptor;
+using fit::compress_adaptor;
+using fit::conditional_adaptor;
+using fit::decorate_adaptor;
+using fit::default_adaptor;
+using fit::fix_adaptor;
+using fit::flip_adaptor;
+using fit::flow_adaptor;
+using fit::implicit;
+using fit::indirect_adaptor;
+using fit::infix_adaptor;
+using fit::lazy_adaptor;
+using fit::match_adaptor;
+using fit::mutable_adaptor;
+using fit::partial_adaptor;
+using fit::pipable_adaptor;
+using fit::profile_adaptor;
+using fit::protect_adaptor;
+using fit::reduce_adaptor;
+using fit::result_adaptor;
+using fit::reveal_adaptor;
+using fit::reverse_compress_adaptor;
+using fit::rotate_adaptor;
+using fit::shared_adaptor;
+using fit::static_;
+using fit::switch_adaptor;
+using fit::table_adaptor;
+using fit::thread_local_adaptor;
+using fit::thunk_adaptor;
+using fit::trace_adaptor;
+using fit::unpack_adaptor;
+using fit::when_adaptor;
+
+// Utilities and customization points
+using fit::alias;
+using fit::alias_inherit;
+using fit::alias_static;
+using fit::alias_tag;
+using fit::alias_value;
+using fit::bounded_sequence;
+using fit::chunk_view;
+using fit::enumerate_view;
+using fit::failure_for;
+using fit::failure_map;
+using fit::filter_view;
+using fit::function_param_limit;
+using fit::has_tag;
+using fit::is_callable;
+using fit::is_unpackable;
+using fit::is_visitable;
+using fit::profile_format;
+using fit::profile_record;
+using fit::take_view;
+using fit::transform_view;
+using fit::unpack_sequence;
+using fit::variant_traits;
+using fit::with_failures;
+using fit::zip_view;
+
+// Found by argument-dependent lookup, but they still have to be exported so
+// they are not discarded from the global module fragment
+using fit::operator<;
+using fit::operator|;
+
+namespace detail {
+
+using fit::detail::operator<;
+using fit::detail::operator|;
+
+} // namespace detail
+
+} // namespace fit
@@ -0,0 +1,57 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    fit-detail.cppm
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+module;
+
+#include <fit/function.hpp>
+#include <fit/lambda.hpp>
+#include <fit/detail/always_ref.hpp>
+#include <fit/detail/and.hpp>
+#include <fit/detail/callable_base.hpp>
+#include <fit/detail/compressed_pair.hpp>
+#include <fit/detail/constexpr_deduce.hpp>
+#include <fit/detail/delegate.hpp>
+#include <fit/detail/forward.hpp>
+#include <fit/detail/holder.hpp>
+#include <fit/detail/make.hpp>
+#include <fit/detail/move.hpp>
+#include <fit/detail/remove_rvalue_reference.hpp>
+#include <fit/detail/seq.hpp>
+#include <fit/detail/static_const_var.hpp>
+
+export module fit:detail;
+
+// The building blocks used to write new adaptors, and the names the macros in
+// <fit/macros.hpp> expand to
+export namespace fit {
+
+using fit::forward;
+using fit::move;
+using fit::static_const_var;
+
+namespace detail {
+
+using fit::detail::and_;
+using fit::detail::callable_base;
+using fit::detail::compressed_pair;
+using fit::detail::constexpr_deduce;
+using fit::detail::constexpr_deduce_unique;
+using fit::detail::enable_if_constructible;
+using fit::detail::gens;
+using fit::detail::holder;
+using fit::detail::is_default_constructible;
+using fit::detail::make;
+using fit::detail::remove_rvalue_reference;
+using fit::detail::reveal_static_const_factory;
+using fit::detail::reveal_static_lambda_function_wrapper_factor;
+using fit::detail::seq;
+using fit::detail::static_function_wrapper;
+using fit::detail::static_function_wrapper_factor;
+
+} // namespace detail
+
+} // namespace fit
@@ -0,0 +1,33 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    fit-pack.cppm
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+module;
+
+#include <fit/pack.hpp>
+#include <fit/pack_view.hpp>
+#include <fit/soa_vector.hpp>
+
+export module fit:pack;
+
+export namespace fit {
+
+using fit::pack;
+using fit::pack_forward;
+using fit::pack_decay;
+using fit::pack_join;
+using fit::pack_filter;
+using fit::pack_transform;
+using fit::pack_index_of;
+using fit::pack_slice;
+using fit::pack_write;
+using fit::pack_view;
+using fit::pack_layout;
+using fit::pack_view_sequence;
+using fit::soa_vector;
+using fit::soa_span;
+
+} // namespace fit
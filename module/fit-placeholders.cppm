@@ -0,0 +1,53 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    fit-placeholders.cppm
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+module;
+
+#include <fit/placeholders.hpp>
+
+export module fit:placeholders;
+
+// The operators are found by argument-dependent lookup, but they still have to
+// be exported so they are not discarded from the global module fragment
+#define FIT_MODULE_EXPORT_OPERATOR(op, name) using fit::operator op;
+#define FIT_MODULE_EXPORT_DETAIL_OPERATOR(op, name) using fit::detail::operator op;
+#define FIT_MODULE_EXPORT_OPERATOR_CLASS(op, name) using fit::operators::name;
+
+export namespace fit {
+
+using fit::placeholder;
+using fit::placeholder_expression;
+
+using fit::_1;
+using fit::_2;
+using fit::_3;
+using fit::_4;
+using fit::_5;
+using fit::_6;
+using fit::_7;
+using fit::_8;
+using fit::_9;
+using fit::_;
+
+FIT_FOREACH_BINARY_OP(FIT_MODULE_EXPORT_OPERATOR)
+
+namespace operators {
+
+using fit::operators::call;
+FIT_FOREACH_BINARY_OP(FIT_MODULE_EXPORT_OPERATOR_CLASS)
+FIT_FOREACH_ASSIGN_OP(FIT_MODULE_EXPORT_OPERATOR_CLASS)
+FIT_FOREACH_UNARY_OP(FIT_MODULE_EXPORT_OPERATOR_CLASS)
+
+} // namespace operators
+
+namespace detail {
+
+FIT_FOREACH_BINARY_OP(FIT_MODULE_EXPORT_DETAIL_OPERATOR)
+
+} // namespace detail
+
+} // namespace fit
@@ -0,0 +1,17 @@
+/*=============================================================================
+    Copyright (c) 2015 Paul Fultz II
+    fit.cppm
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+// The primary module interface unit. The partitions include the headers in
+// their global module fragment and export the names of the library, so
+// importing `fit` gives the same declarations as including the headers. The
+// macros can't be exported from a module, so they are in <fit/macros.hpp>.
+export module fit;
+
+export import :adaptors;
+export import :pack;
+export import :placeholders;
+export import :detail;
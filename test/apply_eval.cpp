@@ -31,3 +31,34 @@ FIT_TEST_CASE()
             []{ return std::unique_ptr<int>(new int(2)); })
         == 3);
 }
+
+struct next_f
+{
+    int* n;
+    int operator()() const
+    {
+        return (*n)++;
+    }
+};
+
+struct in_order_f
+{
+    template<class... Ts>
+    bool operator()(Ts... xs) const
+    {
+        int a[] = { xs... };
+        for(int i=0;i<int(sizeof...(Ts));i++) if (a[i] != i) return false;
+        return true;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    int n = 0;
+    next_f x = { &n };
+    FIT_TEST_CHECK(fit::apply_eval(in_order_f(), 
+        x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+        x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+    ));
+    FIT_TEST_CHECK(n == 32);
+}
@@ -0,0 +1,83 @@
+#define FIT_NO_ORDERD_BRACE_INIT 1
+#include <fit/apply_eval.hpp>
+#include <fit/always.hpp>
+#include <fit/by.hpp>
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+struct next_f
+{
+    int* n;
+    int operator()() const
+    {
+        return (*n)++;
+    }
+};
+
+struct in_order_f
+{
+    template<class... Ts>
+    bool operator()(Ts... xs) const
+    {
+        int a[] = { xs... };
+        for(int i=0;i<int(sizeof...(Ts));i++) if (a[i] != i) return false;
+        return true;
+    }
+};
+
+struct indirect_sum_f
+{
+    template<class T, class U>
+    auto operator()(T x, U y) const
+    FIT_RETURNS(*x + *y);
+};
+
+struct push_f
+{
+    std::vector<int>* v;
+    void operator()(int x) const
+    {
+        v->push_back(x);
+    }
+};
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(fit::apply_eval(binary_class(), fit::always(1), fit::always(2)) == 3);
+    FIT_TEST_CHECK(fit::apply_eval(binary_class(), []{ return 1; }, []{ return 2;}) == 3);
+    fit::apply_eval(fit::always(), fit::always(1), fit::always(2));
+    FIT_TEST_CHECK(fit::apply_eval(fit::always(3)) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(
+        fit::apply_eval(
+            indirect_sum_f(), 
+            []{ return std::unique_ptr<int>(new int(1)); }, 
+            []{ return std::unique_ptr<int>(new int(2)); })
+        == 3);
+}
+
+FIT_TEST_CASE()
+{
+    int n = 0;
+    next_f x = { &n };
+    FIT_TEST_CHECK(fit::apply_eval(in_order_f(), 
+        x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x,
+        x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x
+    ));
+    FIT_TEST_CHECK(n == 32);
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v;
+    push_f p = { &v };
+    fit::by(p)(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    FIT_TEST_CHECK(v.size() == 32);
+    for(int i=0;i<int(v.size());i++) FIT_TEST_CHECK(v[i] == i);
+}
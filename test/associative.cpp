@@ -0,0 +1,106 @@
+#include <fit/associative.hpp>
+#include <fit/compress.hpp>
+#include <fit/reverse_compress.hpp>
+#include <fit/is_callable.hpp>
+#include "test.hpp"
+
+#include <memory>
+#include <string>
+
+struct sum_f
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+// Returns the depth of the calls
+struct depth_f
+{
+    constexpr int operator()(int x, int y) const
+    {
+        return (x > y ? x : y) + 1;
+    }
+};
+
+struct move_sum_f
+{
+    std::unique_ptr<int> operator()(std::unique_ptr<int> x, std::unique_ptr<int> y) const
+    {
+        return std::unique_ptr<int>(new int(*x + *y));
+    }
+};
+
+static_assert(fit::is_callable<fit::associative_adaptor<sum_f>, int, int>::value, "Not callable");
+static_assert(!fit::is_callable<fit::associative_adaptor<sum_f>, int>::value, "Callable");
+static_assert(!std::is_constructible<fit::associative_adaptor<sum_f>, int>::value, "Constructible");
+static_assert(std::is_constructible<fit::associative_adaptor<sum_f>, fit::associative_adaptor<sum_f>&>::value, "Not copyable");
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(fit::associative(sum_f())(1, 2) == 3);
+    FIT_STATIC_TEST_CHECK(fit::associative(sum_f())(1, 2) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(fit::compress(fit::associative(sum_f()))(1) == 1);
+    FIT_TEST_CHECK(fit::compress(fit::associative(sum_f()))(1, 2, 3, 4, 5) == 15);
+    FIT_TEST_CHECK(fit::compress(fit::associative(sum_f()), 10)() == 10);
+    FIT_TEST_CHECK(fit::compress(fit::associative(sum_f()), 10)(1, 2, 3, 4, 5) == 25);
+
+    FIT_STATIC_TEST_CHECK(fit::compress(fit::associative(sum_f()))(1, 2, 3, 4, 5) == 15);
+    FIT_STATIC_TEST_CHECK(fit::compress(fit::associative(sum_f()), 10)(1, 2, 3, 4, 5) == 25);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(fit::reverse_compress(fit::associative(sum_f()))(1, 2, 3, 4, 5) == 15);
+    FIT_TEST_CHECK(fit::reverse_compress(fit::associative(sum_f()), 10)(1, 2, 3, 4, 5) == 25);
+
+    FIT_STATIC_TEST_CHECK(fit::reverse_compress(fit::associative(sum_f()))(1, 2, 3, 4, 5) == 15);
+    FIT_STATIC_TEST_CHECK(fit::reverse_compress(fit::associative(sum_f()), 10)(1, 2, 3, 4, 5) == 25);
+}
+
+FIT_TEST_CASE()
+{
+    // The order is the same as without associative
+    std::string a = "a", b = "b", c = "c", d = "d", e = "e";
+    FIT_TEST_CHECK(fit::compress(fit::associative(sum_f()), std::string())(a, b, c, d, e) ==
+        fit::compress(sum_f(), std::string())(a, b, c, d, e));
+    FIT_TEST_CHECK(fit::reverse_compress(fit::associative(sum_f()), std::string())(a, b, c, d, e) ==
+        fit::reverse_compress(sum_f(), std::string())(a, b, c, d, e));
+    FIT_TEST_CHECK(fit::compress(fit::associative(sum_f()))(a, b, c, d, e) == "abcde");
+    FIT_TEST_CHECK(fit::reverse_compress(fit::associative(sum_f()))(a, b, c, d, e) ==
+        fit::reverse_compress(sum_f())(a, b, c, d, e));
+}
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(fit::compress(depth_f())(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) == 15);
+    FIT_STATIC_TEST_CHECK(fit::compress(fit::associative(depth_f()))(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) == 4);
+    FIT_STATIC_TEST_CHECK(fit::reverse_compress(fit::associative(depth_f()))(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) == 4);
+    FIT_STATIC_TEST_CHECK(fit::compress(fit::associative(depth_f()), 0)(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) == 4);
+    FIT_TEST_CHECK(fit::compress(fit::associative(depth_f()))(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0) == 4);
+}
+
+FIT_TEST_CASE()
+{
+    auto r = fit::compress(fit::associative(move_sum_f()))(
+        std::unique_ptr<int>(new int(1)),
+        std::unique_ptr<int>(new int(2)),
+        std::unique_ptr<int>(new int(3))
+    );
+    FIT_TEST_CHECK(*r == 6);
+}
+
+FIT_TEST_CASE()
+{
+    // A non-const lvalue is copied instead of being passed to the function
+    auto f = fit::associative(sum_f());
+    auto g = f;
+    FIT_TEST_CHECK(g(1, 2) == 3);
+    FIT_TEST_CHECK(fit::compress(g)(1, 2, 3) == 6);
+}
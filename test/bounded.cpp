@@ -0,0 +1,100 @@
+#include <fit/bounded.hpp>
+#include <fit/is_callable.hpp>
+#include <fit/conditional.hpp>
+#include "test.hpp"
+
+#include <vector>
+
+struct sum_f
+{
+    constexpr int operator()() const
+    {
+        return 0;
+    }
+
+    template<class T, class... Ts>
+    constexpr int operator()(T x, Ts... xs) const
+    {
+        return x + sum_f()(xs...);
+    }
+};
+
+struct count_f
+{
+    template<class... Ts>
+    constexpr std::size_t operator()(Ts&&...) const
+    {
+        return sizeof...(Ts);
+    }
+};
+
+struct unary
+{
+    constexpr int operator()(int x) const
+    {
+        return x;
+    }
+};
+
+struct nullary
+{
+    constexpr int operator()() const
+    {
+        return -1;
+    }
+
+    template<class... Ts>
+    constexpr int operator()(Ts...) const
+    {
+        return 1;
+    }
+};
+
+static_assert(fit::is_callable<fit::unpack_adaptor<sum_f>, fit::bounded_sequence<2, int>>::value, "Not callable");
+static_assert(!fit::is_callable<fit::unpack_adaptor<unary>, fit::bounded_sequence<2, int>>::value, "Callable");
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3 };
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::bounded<4>(v.data(), v.size())) == 6);
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::bounded<3>(v.data(), v.size())) == 6);
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::bounded<4>(v.data(), 1)) == 1);
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::bounded<4>(v.data(), 0)) == 0);
+    static_assert(fit::is_unpackable<fit::bounded_sequence<4, int>>::value, "Not unpackable");
+}
+
+FIT_TEST_CASE()
+{
+    const int a[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    for(std::size_t i = 0; i <= 8; i++)
+    {
+        FIT_TEST_CHECK(fit::unpack(count_f())(fit::bounded<8>(a, i)) == i);
+    }
+}
+
+struct increment_f
+{
+    template<class... Ts>
+    void operator()(Ts&... xs) const
+    {
+        int unpack[] = { 0, ++xs... };
+        (void)unpack;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2 };
+    fit::unpack(increment_f())(fit::bounded<2>(v.data(), v.size()));
+    FIT_TEST_CHECK(v[0] == 2);
+    FIT_TEST_CHECK(v[1] == 3);
+}
+
+FIT_TEST_CASE()
+{
+    // A function that can't be called with every number of elements is skipped
+    std::vector<int> v = { 1, 2 };
+    auto f = fit::conditional(fit::unpack(unary()), fit::unpack(nullary()));
+    FIT_TEST_CHECK(f(fit::bounded<2>(v.data(), 0)) == -1);
+    FIT_TEST_CHECK(f(fit::bounded<2>(v.data(), 2)) == 1);
+}
@@ -46,3 +46,48 @@ FIT_TEST_CASE()
     FIT_TEST_CHECK(fit::capture(add_member(1))(&add_member::add)(2) == 3);
 }
 
+
+struct copy_counter
+{
+    int* copies;
+
+    copy_counter(int* c) : copies(c)
+    {}
+
+    copy_counter(const copy_counter& rhs) : copies(rhs.copies)
+    {
+        (*copies)++;
+    }
+};
+
+struct count_f
+{
+    int operator()(const copy_counter& x, int y) const
+    {
+        return *x.copies + y;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    // The captured values are copied once for each call
+    int copies = 0;
+    auto f = fit::capture(copy_counter(&copies))(count_f());
+    int n = copies;
+    FIT_TEST_CHECK(f(1) == n + 2);
+    FIT_TEST_CHECK(f(1) == n + 3);
+    FIT_TEST_CHECK(copies == n + 2);
+}
+
+struct rvalue_f
+{
+    int operator()(int&& x, int y) const
+    {
+        return x + y;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(fit::capture_forward(1)(rvalue_f())(2) == 3);
+}
@@ -1,4 +1,6 @@
 #include <fit/compose.hpp>
+#include <fit/by.hpp>
+#include <fit/conditional.hpp>
 #include <memory>
 #include "test.hpp"
 
@@ -97,4 +99,84 @@ FIT_TEST_CASE()
     int r = f(3);
     FIT_TEST_CHECK(r == 4);
 }
+
+struct move_count
+{
+    int copies;
+    int moves;
+    move_count() : copies(0), moves(0)
+    {}
+};
+
+template<int N>
+struct counted_add
+{
+    move_count* count;
+    counted_add(move_count* c) : count(c)
+    {}
+
+    counted_add(const counted_add& x) : count(x.count)
+    {
+        count->copies++;
+    }
+
+    counted_add(counted_add&& x) : count(x.count)
+    {
+        count->moves++;
+    }
+
+    int operator()(int x) const
+    {
+        return x + N;
+    }
+
+    int operator()(int x, int y) const
+    {
+        return x + y + N;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    move_count c[4];
+    auto f = fit::compose(counted_add<1>(&c[0]), counted_add<2>(&c[1]), counted_add<3>(&c[2]), counted_add<4>(&c[3]));
+    FIT_TEST_CHECK(f(0) == 10);
+    for (const move_count& x : c)
+    {
+        FIT_TEST_CHECK(x.copies == 0);
+        FIT_TEST_CHECK(x.moves == 1);
+    }
+}
+
+FIT_TEST_CASE()
+{
+    move_count c[3];
+    counted_add<1> f1(&c[0]);
+    counted_add<2> f2(&c[1]);
+    counted_add<3> f3(&c[2]);
+    auto f = fit::compose(f1, fit::move(f2), f3);
+    FIT_TEST_CHECK(f(0) == 6);
+    FIT_TEST_CHECK(c[0].copies == 1);
+    FIT_TEST_CHECK(c[0].moves == 0);
+    FIT_TEST_CHECK(c[1].copies == 0);
+    FIT_TEST_CHECK(c[1].moves == 1);
+    FIT_TEST_CHECK(c[2].copies == 1);
+    FIT_TEST_CHECK(c[2].moves == 0);
+}
+
+FIT_TEST_CASE()
+{
+    // Each function is moved once by each adaptor it is nested in
+    move_count p, q, g, h;
+    auto f = fit::compose(fit::by(counted_add<1>(&p), counted_add<4>(&q)), fit::conditional(counted_add<2>(&g), counted_add<3>(&h)));
+    FIT_TEST_CHECK(f(0) == 7);
+    FIT_TEST_CHECK(p.copies == 0);
+    FIT_TEST_CHECK(p.moves == 2);
+    FIT_TEST_CHECK(q.copies == 0);
+    FIT_TEST_CHECK(q.moves == 2);
+    FIT_TEST_CHECK(g.copies == 0);
+    FIT_TEST_CHECK(g.moves == 2);
+    FIT_TEST_CHECK(h.copies == 0);
+    FIT_TEST_CHECK(h.moves == 2);
+}
 }
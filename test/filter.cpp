@@ -53,3 +53,11 @@ FIT_TEST_CASE()
 }
 
 
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(fit::unpack(make_tuple_f())(fit::pack_filter<std::is_integral>(fit::pack(1, 2, 2.0, 3))) == 
+        filter_integers()(fit::pack(1, 2, 2.0, 3)));
+#if FIT_HAS_CONSTEXPR_TUPLE
+    FIT_STATIC_TEST_CHECK(fit::unpack(make_tuple_f())(fit::pack_filter<std::is_integral>(fit::pack(1, 2, 2.0, 3))) == std::make_tuple(1, 2, 3));
+#endif
+}
@@ -1,8 +1,13 @@
 #include <fit/fix.hpp>
 #include <fit/static.hpp>
 #include <fit/reveal.hpp>
+#include <fit/repeat.hpp>
+#include <fit/compress.hpp>
+#include <fit/reverse_compress.hpp>
+#include <fit/detail/seq.hpp>
 #include "test.hpp"
 
+#include <cstdint>
 #include <memory>
 
 struct factorial_t
@@ -50,3 +55,74 @@ FIT_TEST_CASE()
     FIT_TEST_CHECK(r == 5*4*3*2*1);
     FIT_TEST_CHECK(fit::fix(factorial_move_t())(5) == 5*4*3*2*1);
 }
+
+#if FIT_FIX_HAS_CONSTEXPR
+struct fibonacci_t
+{
+    template<class Self>
+    constexpr int operator()(Self s, int n) const
+    {
+        return n < 2 ? n : s(n-1) + s(n-2);
+    }
+};
+
+struct crc_t
+{
+    template<class Self>
+    constexpr std::uint32_t operator()(Self s, std::uint32_t c, int bits) const
+    {
+        return bits == 0 ? c : s((c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1, bits - 1);
+    }
+};
+
+struct crc_table
+{
+    std::uint32_t data[256];
+};
+
+template<std::size_t... Ns>
+constexpr crc_table make_crc_table(fit::detail::seq<Ns...>)
+{
+    return {{ fit::fix(crc_t())(std::uint32_t(Ns), 8)... }};
+}
+
+struct max_f
+{
+    template<class T, class U>
+    constexpr T operator()(T x, U y) const
+    {
+        return x > y ? x : y;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(factorial(0) == 1);
+    FIT_STATIC_TEST_CHECK(factorial(5) == 5*4*3*2*1);
+    FIT_STATIC_TEST_CHECK(fit::reveal(factorial)(5) == 5*4*3*2*1);
+    FIT_STATIC_TEST_CHECK(fit::fix(factorial_t())(10) == 3628800);
+
+    FIT_STATIC_TEST_CHECK(fit::fix(fibonacci_t())(1) == 1);
+    FIT_STATIC_TEST_CHECK(fit::fix(fibonacci_t())(10) == 55);
+    FIT_STATIC_TEST_CHECK(fit::fix(fibonacci_t())(20) == 6765);
+    FIT_TEST_CHECK(fit::fix(fibonacci_t())(20) == 6765);
+}
+
+FIT_TEST_CASE()
+{
+    static constexpr crc_table table = make_crc_table(fit::detail::gens<256>::type());
+    FIT_STATIC_TEST_CHECK(table.data[0] == 0);
+    FIT_STATIC_TEST_CHECK(table.data[1] == 0x77073096u);
+    FIT_STATIC_TEST_CHECK(table.data[128] == 0xEDB88320u);
+    FIT_STATIC_TEST_CHECK(table.data[255] == 0x2D02EF8Du);
+    FIT_TEST_CHECK(table.data[255] == fit::fix(crc_t())(255u, 8));
+}
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(fit::repeat(std::integral_constant<int, 2>())(factorial)(3) == 720);
+    FIT_STATIC_TEST_CHECK(fit::compress(max_f())(factorial(3), fit::fix(fibonacci_t())(10), 7) == 55);
+    FIT_STATIC_TEST_CHECK(fit::reverse_compress(max_f())(factorial(4), fit::fix(fibonacci_t())(8), 7) == 24);
+    FIT_STATIC_TEST_CHECK(fit::compress(max_f(), 0)() == 0);
+}
+#endif
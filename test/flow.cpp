@@ -97,4 +97,52 @@ FIT_TEST_CASE()
     int r = f(3);
     FIT_TEST_CHECK(r == 4);
 }
+
+struct move_count
+{
+    int copies;
+    int moves;
+    move_count() : copies(0), moves(0)
+    {}
+};
+
+template<int N>
+struct counted_add
+{
+    move_count* count;
+    counted_add(move_count* c) : count(c)
+    {}
+
+    counted_add(const counted_add& x) : count(x.count)
+    {
+        count->copies++;
+    }
+
+    counted_add(counted_add&& x) : count(x.count)
+    {
+        count->moves++;
+    }
+
+    int operator()(int x) const
+    {
+        return x + N;
+    }
+
+    int operator()(int x, int y) const
+    {
+        return x + y + N;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    move_count c[4];
+    auto f = fit::flow(counted_add<1>(&c[0]), counted_add<2>(&c[1]), counted_add<3>(&c[2]), counted_add<4>(&c[3]));
+    FIT_TEST_CHECK(f(0) == 10);
+    for (const move_count& x : c)
+    {
+        FIT_TEST_CHECK(x.copies == 0);
+        FIT_TEST_CHECK(x.moves == 1);
+    }
+}
 }
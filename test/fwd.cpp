@@ -0,0 +1,68 @@
+#include <fit/fwd.hpp>
+#include <utility>
+
+struct pair_sequence;
+
+// Customization points can be specialized with only the forward declarations
+namespace fit {
+
+template<>
+struct unpack_sequence<pair_sequence>
+{
+    template<class F, class S>
+    constexpr static auto apply(F&& f, S&& s) -> decltype(f(s.first, s.second))
+    {
+        return f(s.first, s.second);
+    }
+};
+
+}
+
+struct increment_class;
+int call_compose(const fit::compose_adaptor<increment_class, increment_class>& f, int x);
+int call_partial(const fit::partial_adaptor<increment_class>& f, int x);
+
+#include <fit/by.hpp>
+#include <fit/compose.hpp>
+#include <fit/compress.hpp>
+#include <fit/partial.hpp>
+#include <fit/reverse_compress.hpp>
+#include <fit/unpack.hpp>
+#include <fit/visit_match.hpp>
+#include "test.hpp"
+
+struct pair_sequence
+{
+    int first;
+    int second;
+};
+
+struct increment_class
+{
+    constexpr int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+int call_compose(const fit::compose_adaptor<increment_class, increment_class>& f, int x)
+{
+    return f(x);
+}
+
+int call_partial(const fit::partial_adaptor<increment_class>& f, int x)
+{
+    return f(x);
+}
+
+STATIC_ASSERT_SAME(fit::by_adaptor<increment_class>, fit::by_adaptor<increment_class, void>);
+STATIC_ASSERT_SAME(fit::compress_adaptor<binary_class>, fit::compress_adaptor<binary_class, void>);
+STATIC_ASSERT_SAME(fit::reverse_compress_adaptor<binary_class>, fit::reverse_compress_adaptor<binary_class, void>);
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(call_compose(fit::compose(increment_class(), increment_class()), 1) == 3);
+    FIT_TEST_CHECK(call_partial(fit::partial(increment_class()), 1) == 2);
+    pair_sequence p = { 1, 2 };
+    FIT_TEST_CHECK(fit::unpack(binary_class())(p) == 3);
+}
@@ -1,4 +1,5 @@
 #include <fit/if.hpp>
+#include <fit/always.hpp>
 #include "test.hpp"
 
 #include <fit/conditional.hpp>
@@ -0,0 +1,44 @@
+#include <fit/macros.hpp>
+
+// Only the macros are defined, so the names they expand to are declared by
+// the module or by the headers
+#if defined(FIT_GUARD_RETURNS_H) || defined(FIT_GUARD_FUNCTION_FUNCTION_H) || defined(FIT_GUARD_FUNCTION_LAMBDA_H) || defined(FIT_GUARD_FUNCTION_LIFT_H)
+#error "macros.hpp includes the headers of the library"
+#endif
+
+#include <fit/function.hpp>
+#include <fit/lambda.hpp>
+#include <fit/partial.hpp>
+#include "test.hpp"
+
+struct sum_f
+{
+    template<class T, class U>
+    constexpr auto operator()(T x, U y) const FIT_RETURNS(x + y);
+};
+
+FIT_STATIC_FUNCTION(sum) = fit::partial(sum_f());
+
+FIT_LIFT_CLASS(sum_class, sum);
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(sum(1, 2) == 3);
+    FIT_TEST_CHECK(sum(1)(2) == 3);
+    FIT_STATIC_TEST_CHECK(sum(1, 2) == 3);
+
+    FIT_TEST_CHECK(sum_class()(1, 2) == 3);
+    FIT_STATIC_TEST_CHECK(sum_class()(1, 2) == 3);
+}
+
+#if FIT_HAS_STATIC_LAMBDA
+static constexpr auto add_one = FIT_STATIC_LAMBDA(int x)
+{
+    return x + 1;
+};
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(add_one(2) == 3);
+}
+#endif
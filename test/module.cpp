@@ -0,0 +1,44 @@
+#include <fit/macros.hpp>
+#include "test.hpp"
+import fit;
+
+struct sum_f
+{
+    template<class T, class U>
+    constexpr auto operator()(T x, U y) const FIT_RETURNS(x + y);
+};
+
+FIT_STATIC_FUNCTION(sum) = fit::partial(sum_f());
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(sum(1, 2) == 3);
+    FIT_TEST_CHECK(sum(1)(2) == 3);
+    FIT_STATIC_TEST_CHECK(sum(1, 2) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    auto increment = FIT_LIFT(sum)(1);
+    FIT_TEST_CHECK(fit::compose(increment, increment)(1) == 3);
+    FIT_TEST_CHECK(fit::flow(fit::_1 * 2, fit::_1 + 1)(3) == 7);
+    FIT_TEST_CHECK((fit::_ + 1)(2) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    auto p = fit::pack(1, 2, 3);
+    FIT_TEST_CHECK(p(fit::_1 + fit::_2 + fit::_3) == 6);
+    FIT_TEST_CHECK(fit::unpack(sum_f())(std::make_tuple(1, 2)) == 3);
+    FIT_TEST_CHECK((1 | fit::pipable(sum_f())(2)) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::conditional(
+        [](int x) { return x; },
+        fit::always(0)
+    );
+    FIT_TEST_CHECK(f(1) == 1);
+    FIT_TEST_CHECK(f("") == 0);
+}
@@ -336,3 +336,125 @@ FIT_TEST_CASE()
 }
 
 
+
+struct sum_f
+{
+    template<class T, class... Ts>
+    constexpr long long operator()(T x, Ts... xs) const
+    {
+        return x + sum_f()(xs...);
+    }
+
+    constexpr long long operator()() const
+    {
+        return 0;
+    }
+};
+
+#define FIT_PACK_TEST_16(n) n+0, n+1, n+2, n+3, n+4, n+5, n+6, n+7, n+8, n+9, n+10, n+11, n+12, n+13, n+14, n+15
+
+FIT_TEST_CASE()
+{
+    // Elements of the same arithmetic type are stored contiguously
+    static_assert(sizeof(decltype(fit::pack(1, 2, 3, 4))) == 4*sizeof(int), "Pack is not contiguous");
+    static_assert(sizeof(decltype(fit::pack(1.0, 2.0))) == 2*sizeof(double), "Pack is not contiguous");
+    static_assert(std::is_base_of<fit::detail::pack_array<int, 4>, decltype(fit::pack(1, 2, 3, 4))>::value, "Pack is not an array");
+    static_assert(!std::is_base_of<fit::detail::pack_array<int, 2>, decltype(fit::pack(1, 2l))>::value, "Pack is an array");
+
+    FIT_TEST_CHECK(fit::pack(1, 2)(binary_class()) == 3);
+    FIT_STATIC_TEST_CHECK(fit::pack(1, 2)(binary_class()) == 3);
+
+    auto p = fit::pack(FIT_PACK_TEST_16(0), FIT_PACK_TEST_16(16), FIT_PACK_TEST_16(32), FIT_PACK_TEST_16(48));
+    static_assert(sizeof(p) == 64*sizeof(int), "Pack is not contiguous");
+    FIT_TEST_CHECK(p(sum_f()) == 64*63/2);
+    FIT_STATIC_TEST_CHECK(fit::pack(FIT_PACK_TEST_16(0), FIT_PACK_TEST_16(16), FIT_PACK_TEST_16(32), FIT_PACK_TEST_16(48))(sum_f()) == 64*63/2);
+    auto p2 = p;
+    FIT_TEST_CHECK(p2(sum_f()) == 64*63/2);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(fit::pack_join(fit::pack(1, 2), fit::pack(3, 4))(sum_f()) == 10);
+    FIT_TEST_CHECK(fit::pack_join(fit::pack(1, 2), fit::pack(3, 4))(sum_f()) == 10);
+    FIT_TEST_CHECK(fit::pack_join(fit::pack(1, 2), fit::pack(3l))(sum_f()) == 6);
+    FIT_STATIC_TEST_CHECK(fit::pack_decay(1, 2, 3)(sum_f()) == 6);
+    auto p = fit::pack(1, 2);
+    static_assert(fit::detail::is_default_constructible<decltype(p)>::value, "Pack not default constructible");
+    FIT_TEST_CHECK(decltype(p)()(binary_class()) == 0);
+}
+
+struct make_tuple_f
+{
+    template<class... Ts>
+    constexpr std::tuple<Ts...> operator()(Ts... xs) const
+    {
+        return std::tuple<Ts...>(xs...);
+    }
+};
+
+struct twice_f
+{
+    template<class T>
+    constexpr T operator()(T x) const
+    {
+        return x + x;
+    }
+};
+
+struct deref_f
+{
+    int operator()(const std::unique_ptr<int>& x) const
+    {
+        return *x;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(fit::pack_filter<std::is_integral>(fit::pack(1, 2.0, 3, 'a'))(make_tuple_f()) == std::make_tuple(1, 3, 'a'));
+    FIT_TEST_CHECK(fit::pack_filter<std::is_integral>(fit::pack(1, 2.0, 3, 'a'))(make_tuple_f()) == std::make_tuple(1, 3, 'a'));
+    FIT_STATIC_TEST_CHECK(fit::pack_filter<std::is_floating_point>(fit::pack(1, 2.0, 3, 4.0f))(make_tuple_f()) == std::make_tuple(2.0, 4.0f));
+    FIT_STATIC_TEST_CHECK(fit::pack_filter<std::is_pointer>(fit::pack(1, 2.0))(make_tuple_f()) == std::make_tuple());
+    FIT_STATIC_TEST_CHECK(fit::pack_filter<std::is_integral>(fit::pack())(make_tuple_f()) == std::make_tuple());
+
+    // The predicate is applied to the decayed type, and references are kept
+    int x = 1;
+    double y = 2.0;
+    auto p = fit::pack_filter<std::is_integral>(fit::pack(x, y));
+    static_assert(std::is_same<decltype(p), decltype(fit::pack(x))>::value, "Reference not kept");
+    x = 5;
+    FIT_TEST_CHECK(p(fit::identity) == 5);
+
+    // Move only elements are moved from an rvalue pack
+    auto q = fit::pack_filter<std::is_class>(fit::pack(1, std::unique_ptr<int>(new int(3))));
+    FIT_TEST_CHECK(q(deref_f()) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(fit::pack_transform(fit::pack(1, 2.0), twice_f())(make_tuple_f()) == std::make_tuple(2, 4.0));
+    FIT_TEST_CHECK(fit::pack_transform(fit::pack(1, 2.0), twice_f())(make_tuple_f()) == std::make_tuple(2, 4.0));
+    FIT_STATIC_TEST_CHECK(fit::pack_transform(fit::pack(), twice_f())(make_tuple_f()) == std::make_tuple());
+    auto p = fit::pack(FIT_PACK_TEST_16(0), FIT_PACK_TEST_16(16), FIT_PACK_TEST_16(32), FIT_PACK_TEST_16(48));
+    FIT_TEST_CHECK(fit::pack_transform(p, twice_f())(sum_f()) == 64*63);
+}
+
+FIT_TEST_CASE()
+{
+    static_assert(decltype(fit::pack_index_of<double>(fit::pack(1, 2.0, 3.0)))::value == 1, "Wrong index");
+    static_assert(decltype(fit::pack_index_of<int>(fit::pack(1, 2.0, 3)))::value == 0, "Wrong index");
+    static_assert(decltype(fit::pack_index_of<float>(fit::pack(1, 2.0, 3)))::value == 3, "Wrong index");
+    static_assert(decltype(fit::pack_index_of<int>(fit::pack()))::value == 0, "Wrong index");
+    int x = 1;
+    FIT_TEST_CHECK(fit::pack_index_of<int>(fit::pack(2.0, x)) == 1);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_STATIC_TEST_CHECK(fit::pack_slice<1, 3>(fit::pack(1, 2.0, 3, 'a'))(make_tuple_f()) == std::make_tuple(2.0, 3));
+    FIT_STATIC_TEST_CHECK(fit::pack_slice<0, 4>(fit::pack(1, 2.0, 3, 'a'))(make_tuple_f()) == std::make_tuple(1, 2.0, 3, 'a'));
+    FIT_STATIC_TEST_CHECK(fit::pack_slice<2, 2>(fit::pack(1, 2.0, 3, 'a'))(make_tuple_f()) == std::make_tuple());
+    FIT_TEST_CHECK(fit::pack_slice<3, 4>(fit::pack(1, 2.0, 3, 'a'))(make_tuple_f()) == std::make_tuple('a'));
+    auto p = fit::pack(FIT_PACK_TEST_16(0), FIT_PACK_TEST_16(16), FIT_PACK_TEST_16(32), FIT_PACK_TEST_16(48));
+    FIT_TEST_CHECK(fit::pack_slice<16, 32>(p)(sum_f()) == 16*16 + 15*16/2);
+}
@@ -0,0 +1,111 @@
+#include <fit/pack_view.hpp>
+#include "test.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+struct sum_f
+{
+    template<class... Ts>
+    double operator()(Ts... xs) const
+    {
+        double r = 0;
+        int x[] = { 0, (r += xs, 0)... };
+        (void)x;
+        return r;
+    }
+};
+
+struct point
+{
+    float x;
+    float y;
+};
+
+struct point_f
+{
+    float operator()(char c, point p, double d) const
+    {
+        return c + p.x * p.y + float(d);
+    }
+};
+
+static_assert(fit::pack_layout<int>::size() == sizeof(int), "Wrong size");
+static_assert(fit::pack_layout<>::size() == 0, "Wrong size");
+static_assert(fit::pack_layout<char, short>::offset(1) == alignof(short), "Wrong offset");
+static_assert(fit::pack_layout<char, short>::size() == 2 * alignof(short), "Wrong size");
+static_assert(fit::pack_layout<char, double, char>::offset(1) == alignof(double), "Wrong offset");
+static_assert(fit::pack_layout<char, double, char>::size() % alignof(double) == 0, "Wrong size");
+static_assert(fit::pack_layout<char, double, char>::alignment() == alignof(double), "Wrong alignment");
+static_assert(fit::is_unpackable<fit::pack_view_sequence<int, double>>::value, "Not unpackable");
+
+FIT_TEST_CASE()
+{
+    // The layout is the same as a struct
+    struct record { char c; double d; short s; };
+    typedef fit::pack_layout<char, double, short> layout;
+    FIT_STATIC_TEST_CHECK(layout::size() == sizeof(record));
+    FIT_STATIC_TEST_CHECK(layout::alignment() == alignof(record));
+    FIT_TEST_CHECK(layout::offset(1) == offsetof(record, d));
+    FIT_TEST_CHECK(layout::offset(2) == offsetof(record, s));
+}
+
+FIT_TEST_CASE()
+{
+    unsigned char buffer[64];
+    unsigned char* end = fit::pack_write(buffer, fit::pack('a', point{ 2, 3 }, 0.5));
+    FIT_TEST_CHECK(end == buffer + fit::pack_layout<char, point, double>::size());
+    auto v = fit::pack_view<char, point, double>(buffer);
+    FIT_TEST_CHECK(v.get<0>() == 'a');
+    FIT_TEST_CHECK(v.get<1>().y == 3);
+    FIT_TEST_CHECK(v.get<2>() == 0.5);
+    FIT_TEST_CHECK(fit::unpack(point_f())(v) == 'a' + 6.5f);
+}
+
+FIT_TEST_CASE()
+{
+    // Tuples, pairs and arrays can be written too
+    unsigned char buffer[64];
+    fit::pack_write(buffer, std::make_tuple(1, 2.5, short(3)));
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::pack_view<int, double, short>(buffer)) == 6.5);
+    fit::pack_write(buffer, std::make_pair('a', 1L));
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::pack_view<char, long>(buffer)) == 'a' + 1);
+    std::array<int, 3> a = {{ 1, 2, 3 }};
+    fit::pack_write(buffer, a);
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::pack_view<int, int, int>(buffer)) == 6);
+}
+
+FIT_TEST_CASE()
+{
+    // The buffer doesn't have to be aligned
+    unsigned char buffer[64];
+    fit::pack_write(buffer + 1, fit::pack(short(2), 1.5));
+    FIT_TEST_CHECK(fit::unpack(sum_f())(fit::pack_view<short, double>(buffer + 1)) == 3.5);
+}
+
+FIT_TEST_CASE()
+{
+    // Records are stored one after the other
+    typedef fit::pack_layout<int, double> layout;
+    std::vector<unsigned char> buffer(100 * layout::size());
+    unsigned char* out = buffer.data();
+    for (int i = 0; i < 100; i++) out = fit::pack_write(out, fit::pack(i, i * 0.5));
+    FIT_TEST_CHECK(out == buffer.data() + buffer.size());
+    double sum = 0;
+    for (const unsigned char* in = buffer.data(); in != out; in += layout::size())
+        sum += fit::unpack(sum_f())(fit::pack_view<int, double>(in));
+    FIT_TEST_CHECK(sum == 4950 * 1.5);
+}
+
+FIT_TEST_CASE()
+{
+    // The padding is written as zeros
+    unsigned char buffer[16];
+    for (unsigned char& x : buffer) x = 0xff;
+    fit::pack_write(buffer, fit::pack('a', 1));
+    for (std::size_t i = 1; i < fit::pack_layout<char, int>::offset(1); i++)
+        FIT_TEST_CHECK(buffer[i] == 0);
+}
@@ -80,3 +80,86 @@ FIT_TEST_CASE()
     static_assert(!fit::is_callable<decltype(g), int, int, int>::value, "Passing the limit is not callable");
     static_assert(!fit::is_callable<decltype(g), int, int, int, int>::value, "Passing the limit is not callable");
 }
+
+struct copy_counter
+{
+    static int copies;
+
+    copy_counter()
+    {}
+
+    copy_counter(const copy_counter&)
+    {
+        copies++;
+    }
+
+    copy_counter(copy_counter&&)
+    {}
+};
+
+int copy_counter::copies = 0;
+
+template<int N>
+struct count_args_f
+{
+    template<class... Ts, class=typename std::enable_if<(sizeof...(Ts) == N)>::type>
+    int operator()(Ts&&...) const
+    {
+        return N;
+    }
+};
+
+template<class P>
+int curry(P&& p, std::integral_constant<int, 1>)
+{
+    return fit::forward<P>(p)(copy_counter());
+}
+
+template<class P, int N>
+int curry(P&& p, std::integral_constant<int, N>)
+{
+    return curry(fit::forward<P>(p)(copy_counter()), std::integral_constant<int, N-1>());
+}
+
+template<int N>
+void check_curry()
+{
+    copy_counter::copies = 0;
+    FIT_TEST_CHECK(curry(fit::partial(count_args_f<N>()), std::integral_constant<int, N>()) == N);
+#if FIT_PARTIAL_HAS_RVALUE_THIS
+    FIT_TEST_CHECK(copy_counter::copies == 0);
+#endif
+}
+
+FIT_TEST_CASE()
+{
+    check_curry<1>();
+    check_curry<2>();
+    check_curry<3>();
+    check_curry<4>();
+    check_curry<5>();
+    check_curry<6>();
+    check_curry<7>();
+    check_curry<8>();
+    check_curry<9>();
+    check_curry<10>();
+    check_curry<11>();
+    check_curry<12>();
+    check_curry<13>();
+    check_curry<14>();
+    check_curry<15>();
+    check_curry<16>();
+}
+
+FIT_TEST_CASE()
+{
+    // An lvalue partial keeps its bound arguments
+    copy_counter c;
+    auto f = fit::partial(count_args_f<3>())(c);
+    copy_counter::copies = 0;
+    auto g = f(c);
+    FIT_TEST_CHECK(copy_counter::copies == 2);
+    FIT_TEST_CHECK(g(c) == 3);
+    FIT_TEST_CHECK(f(c, c) == 3);
+    FIT_TEST_CHECK(f(c)(c) == 3);
+}
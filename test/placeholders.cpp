@@ -855,3 +855,31 @@ FIT_TEST_CASE()
     // TODO: Test post increment and decrement
 }
 
+
+FIT_TEST_CASE()
+{
+    FIT_PLACEHOLDER_TEST_CONSTEXPR auto f = fit::_1 * fit::_2 + fit::_3 * fit::_4;
+    static_assert(fit::detail::is_default_constructible<decltype(f)>::value, "Not default constructible");
+    FIT_STATIC_TEST_CHECK(f(1, 2, 3, 4) == 14);
+    FIT_TEST_CHECK(f(1, 2, 3, 4) == 14);
+
+    FIT_PLACEHOLDER_TEST_CONSTEXPR auto g = (fit::_1 + 1) * (fit::_2 - fit::_1) > 3;
+    FIT_STATIC_TEST_CHECK(g(1, 3));
+    FIT_TEST_CHECK(!g(1, 2));
+
+    FIT_PLACEHOLDER_TEST_CONSTEXPR auto h = -(fit::_1 + fit::_2);
+    FIT_STATIC_TEST_CHECK(h(1, 2) == -3);
+    FIT_TEST_CHECK(h(1, 2) == -3);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::_1 + fit::lazy(square())(fit::_2) * fit::_3;
+    FIT_TEST_CHECK(f(1, 2, 3) == 13);
+
+    int x = 1;
+    auto g = fit::_1 += std::ref(x);
+    int y = 2;
+    g(y);
+    FIT_TEST_CHECK(y == 3);
+}
@@ -0,0 +1,126 @@
+#include <fit/profile.hpp>
+#include <fit/compose.hpp>
+#include <fit/conditional.hpp>
+#include <fit/function.hpp>
+#include "test.hpp"
+
+#include <sstream>
+#include <thread>
+#include <cstdio>
+
+static fit::profile_record find_record(const std::string& name)
+{
+    for (const fit::profile_record& r : fit::profile_snapshot())
+    {
+        if (r.name == name) return r;
+    }
+    return fit::profile_record();
+}
+
+static std::uint64_t histogram_count(const fit::profile_record& r)
+{
+    std::uint64_t n = 0;
+    for (std::uint64_t x : r.histogram) n += x;
+    return n;
+}
+
+struct increment_class
+{
+    constexpr int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct int_class
+{
+    int operator()(int) const
+    {
+        return 1;
+    }
+};
+
+struct string_class
+{
+    int operator()(const std::string&) const
+    {
+        return 2;
+    }
+};
+
+FIT_STATIC_FUNCTION(profile_increment) = fit::profile(increment_class());
+
+FIT_TEST_CASE()
+{
+    auto f = fit::profile(binary_class(), "binary");
+    FIT_TEST_CHECK(f(1, 2) == 3);
+    FIT_TEST_CHECK(f(2, 2) == 4);
+    fit::profile_record r = find_record("binary");
+    FIT_TEST_CHECK(r.count == 2);
+    FIT_TEST_CHECK(r.min <= r.max);
+    FIT_TEST_CHECK(r.total >= r.max);
+    FIT_TEST_CHECK(histogram_count(r) == 2);
+}
+
+FIT_TEST_CASE()
+{
+    auto inner = fit::profile(increment_class(), "compose_inner");
+    auto f = fit::compose(fit::profile(increment_class(), "compose_outer"), inner);
+    FIT_TEST_CHECK(f(1) == 3);
+    FIT_TEST_CHECK(find_record("compose_outer").count == 1);
+    FIT_TEST_CHECK(find_record("compose_inner").count == 1);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::conditional(fit::profile(int_class(), "conditional_int"), fit::profile(string_class(), "conditional_string"));
+    FIT_TEST_CHECK(f(1) == 1);
+    FIT_TEST_CHECK(f(std::string()) == 2);
+    FIT_TEST_CHECK(f(std::string()) == 2);
+    FIT_TEST_CHECK(find_record("conditional_int").count == 1);
+    FIT_TEST_CHECK(find_record("conditional_string").count == 2);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(profile_increment(1) == 2);
+    FIT_TEST_CHECK(find_record(fit::detail::type_name<increment_class>()).count == 1);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::profile(increment_class(), "threads");
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&] 
+        {
+            for (int j = 0; j < 100; j++) f(j);
+        });
+    }
+    for (auto& t : threads) t.join();
+    f(1);
+    fit::profile_record r = find_record("threads");
+    FIT_TEST_CHECK(r.count == 401);
+    FIT_TEST_CHECK(histogram_count(r) == 401);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::profile(increment_class(), "write \"quoted\"");
+    f(1);
+    std::stringstream text;
+    fit::profile_write(text);
+    FIT_TEST_CHECK(text.str().find("write \"quoted\": count=1") != std::string::npos);
+
+    std::stringstream json;
+    fit::profile_write(json, fit::profile_format::json);
+    FIT_TEST_CHECK(json.str().find("{\"name\": \"write \\\"quoted\\\"\", \"count\": 1,") != std::string::npos);
+
+    const char* filename = "fit_profile_test.json";
+    FIT_TEST_CHECK(fit::profile_dump(filename, fit::profile_format::json));
+    std::remove(filename);
+
+    fit::profile_reset();
+    FIT_TEST_CHECK(find_record("write \"quoted\"").count == 0);
+}
@@ -0,0 +1,135 @@
+// Small chunks, so ranges with a few elements are split between threads
+#define FIT_REDUCE_CHUNK_SIZE 1
+#include <fit/reduce.hpp>
+#include <fit/compress.hpp>
+#include <fit/associative.hpp>
+#include <fit/is_callable.hpp>
+#include "test.hpp"
+
+#include <array>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct sum_f
+{
+    template<class T, class U>
+    T operator()(T x, U y) const
+    {
+        return x + y;
+    }
+};
+
+// Joins adjacent intervals, which is associative but not commutative
+struct interval
+{
+    int first;
+    int last;
+    bool valid;
+
+    interval(int x) : first(x), last(x), valid(true)
+    {}
+
+    interval(int f, int l, bool v) : first(f), last(l), valid(v)
+    {}
+};
+
+struct join_f
+{
+    interval operator()(const interval& x, const interval& y) const
+    {
+        return interval(x.first, y.last, x.valid && y.valid && x.last + 1 == y.first);
+    }
+};
+
+static_assert(fit::is_callable<fit::reduce_adaptor<sum_f>, std::vector<int>>::value, "Not callable");
+static_assert(fit::is_callable<fit::reduce_adaptor<sum_f>, std::vector<int>, std::size_t>::value, "Not callable");
+static_assert(!fit::is_callable<fit::reduce_adaptor<sum_f>, int>::value, "Callable");
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v(100000);
+    std::iota(v.begin(), v.end(), 0);
+    long long expected = 100000LL * 99999 / 2;
+    std::vector<long long> w(v.begin(), v.end());
+    FIT_TEST_CHECK(fit::reduce(sum_f())(w) == expected);
+    FIT_TEST_CHECK(fit::deterministic_reduce(sum_f())(w) == expected);
+    for(std::size_t threads=1;threads<10;threads++)
+    {
+        FIT_TEST_CHECK(fit::reduce(sum_f())(w, threads) == expected);
+        FIT_TEST_CHECK(fit::deterministic_reduce(sum_f())(w, threads) == expected);
+    }
+    FIT_TEST_CHECK(fit::reduce(sum_f())(w, 0) == fit::reduce(sum_f())(w, 1));
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v(50000);
+    std::iota(v.begin(), v.end(), 0);
+    for(std::size_t threads=1;threads<10;threads++)
+    {
+        interval r = fit::reduce(join_f())(v, threads);
+        FIT_TEST_CHECK(r.valid);
+        FIT_TEST_CHECK(r.first == 0);
+        FIT_TEST_CHECK(r.last == 49999);
+        interval d = fit::deterministic_reduce(join_f())(v, threads);
+        FIT_TEST_CHECK(d.valid);
+        FIT_TEST_CHECK(d.first == 0);
+        FIT_TEST_CHECK(d.last == 49999);
+    }
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v(10000);
+    std::iota(v.begin(), v.end(), 1);
+    interval r = fit::reduce(fit::compress(join_f(), interval(0)))(v, 4);
+    FIT_TEST_CHECK(r.valid);
+    FIT_TEST_CHECK(r.first == 0);
+    FIT_TEST_CHECK(r.last == 10000);
+    FIT_TEST_CHECK(fit::reduce(fit::compress(sum_f(), 10))(v, 4) == 10 + 10000 * 10001 / 2);
+    FIT_TEST_CHECK(fit::reduce(fit::compress(sum_f()))(v, 4) == 10000 * 10001 / 2);
+    FIT_TEST_CHECK(fit::reduce(fit::compress(fit::associative(sum_f())))(v, 4) == 10000 * 10001 / 2);
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v;
+    FIT_TEST_CHECK(fit::reduce(fit::compress(sum_f(), 10))(v) == 10);
+    FIT_TEST_CHECK(fit::deterministic_reduce(fit::compress(sum_f(), 10))(v) == 10);
+    int a[] = {1, 2, 3};
+    FIT_TEST_CHECK(fit::reduce(sum_f())(a) == 6);
+    std::array<int, 1> b = {{ 5 }};
+    FIT_TEST_CHECK(fit::reduce(sum_f())(b, 8) == 5);
+    std::vector<std::string> s = {"a", "b", "c"};
+    FIT_TEST_CHECK(fit::reduce(fit::compress(sum_f(), std::string()))(s) == "abc");
+}
+
+FIT_TEST_CASE()
+{
+    // The deterministic result is the same for any number of threads
+    std::vector<double> v(100000);
+    for(std::size_t i=0;i<v.size();i++) v[i] = 1.0 / (i + 1);
+    double expected = fit::deterministic_reduce(sum_f())(v, 1);
+    for(std::size_t threads=2;threads<10;threads++)
+    {
+        double x = fit::deterministic_reduce(sum_f())(v, threads);
+        FIT_TEST_CHECK(std::memcmp(&x, &expected, sizeof(double)) == 0);
+    }
+}
+
+FIT_TEST_CASE()
+{
+    // More threads than elements
+    for(int n=1;n<10;n++)
+    {
+        std::vector<int> v(n);
+        std::iota(v.begin(), v.end(), 1);
+        for(std::size_t threads=1;threads<16;threads++)
+        {
+            FIT_TEST_CHECK(fit::reduce(sum_f())(v, threads) == n * (n + 1) / 2);
+            FIT_TEST_CHECK(fit::deterministic_reduce(sum_f())(v, threads) == n * (n + 1) / 2);
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#include <fit/shared.hpp>
+#include <fit/compose.hpp>
+#include <fit/conditional.hpp>
+#include <fit/is_callable.hpp>
+#include <fit/partial.hpp>
+#include "test.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Counts the copies of the function
+struct rank_less
+{
+    std::vector<int> rank;
+    int* copies;
+
+    rank_less(std::vector<int> r, int* c) : rank(r), copies(c)
+    {}
+
+    rank_less(const rank_less& x) : rank(x.rank), copies(x.copies)
+    {
+        (*copies)++;
+    }
+
+    rank_less(rank_less&&) = default;
+
+    bool operator()(int x, int y) const
+    {
+        return rank[x] < rank[y];
+    }
+};
+
+struct sum_f
+{
+    int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+struct increment_f
+{
+    int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+static_assert(fit::is_callable<fit::shared_adaptor<sum_f>, int, int>::value, "Not callable");
+static_assert(!fit::is_callable<fit::shared_adaptor<sum_f>, int>::value, "Callable");
+static_assert(fit::is_callable<fit::shared_adaptor<sum_f, false>, int, int>::value, "Not callable");
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(fit::shared(sum_f())(1, 2) == 3);
+    FIT_TEST_CHECK(fit::local_shared(sum_f())(1, 2) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    int copies = 0;
+    std::vector<int> rank(1000);
+    for (std::size_t i = 0; i < rank.size(); i++) rank[i] = rank.size() - i;
+    auto less = fit::shared(rank_less(rank, &copies));
+    std::vector<int> v(1000);
+    for (std::size_t i = 0; i < v.size(); i++) v[i] = i;
+    std::sort(v.begin(), v.end(), less);
+    std::stable_sort(v.begin(), v.end(), less);
+    FIT_TEST_CHECK(std::is_sorted(v.begin(), v.end(), less));
+    FIT_TEST_CHECK(v.front() == 999);
+    FIT_TEST_CHECK(v.back() == 0);
+    FIT_TEST_CHECK(copies == 0);
+    FIT_TEST_CHECK(less.use_count() == 1);
+}
+
+FIT_TEST_CASE()
+{
+    int copies = 0;
+    auto less = fit::local_shared(rank_less({ 3, 2, 1 }, &copies));
+    {
+        auto f = less;
+        FIT_TEST_CHECK(less.use_count() == 2);
+        auto g = fit::move(f);
+        FIT_TEST_CHECK(less.use_count() == 2);
+        FIT_TEST_CHECK(f.use_count() == 0);
+        f = g;
+        FIT_TEST_CHECK(less.use_count() == 3);
+        FIT_TEST_CHECK(&f.base_function() == &less.base_function());
+    }
+    FIT_TEST_CHECK(less.use_count() == 1);
+    FIT_TEST_CHECK(copies == 0);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::compose(fit::shared(increment_f()), fit::shared(sum_f()));
+    auto g = f;
+    FIT_TEST_CHECK(g(1, 2) == 4);
+    auto h = fit::partial(fit::shared(sum_f()))(1);
+    FIT_TEST_CHECK(h(2) == 3);
+    FIT_TEST_CHECK(fit::conditional(fit::shared(increment_f()), fit::shared(sum_f()))(1, 2) == 3);
+}
+
+FIT_TEST_CASE()
+{
+    auto p = std::make_shared<int>(1);
+    {
+        auto f = fit::shared([p](int x) { return *p + x; });
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; i++)
+        {
+            threads.emplace_back([f]
+            {
+                for (int j = 0; j < 1000; j++)
+                {
+                    auto g = f;
+                    FIT_TEST_CHECK(g(1) == 2);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        FIT_TEST_CHECK(f.use_count() == 1);
+    }
+    FIT_TEST_CHECK(p.use_count() == 1);
+}
@@ -0,0 +1,186 @@
+#include <fit/soa_vector.hpp>
+#include <fit/by.hpp>
+#include <fit/combine.hpp>
+#include <fit/unpack.hpp>
+#include "test.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct scale
+{
+    void operator()(float& x, float& y, int) const
+    {
+        x *= 2;
+        y *= 2;
+    }
+};
+
+struct sum_f
+{
+    float operator()(float x, float y, int z) const
+    {
+        return x + y + z;
+    }
+};
+
+struct make_tuple_f
+{
+    template<class... Ts>
+    std::tuple<Ts...> operator()(Ts... xs) const
+    {
+        return std::tuple<Ts...>(xs...);
+    }
+};
+
+struct square
+{
+    int operator()(int x) const
+    {
+        return x * x;
+    }
+};
+
+// Throws when it is copied after the limit is reached
+struct throw_on_copy
+{
+    static int copies;
+    throw_on_copy()
+    {}
+
+    throw_on_copy(const throw_on_copy&)
+    {
+        if (++copies > 3) throw std::runtime_error("Copy");
+    }
+};
+
+int throw_on_copy::copies = 0;
+
+static_assert(std::is_same<decltype(std::declval<fit::soa_vector<int, float>&>().column<1>()), fit::soa_span<float>>::value, "Wrong column");
+static_assert(std::is_same<decltype(std::declval<const fit::soa_vector<int, float>&>().column<1>()), fit::soa_span<const float>>::value, "Wrong column");
+static_assert(std::is_same<decltype(std::declval<fit::soa_vector<int, bool>&>().column<1>()), fit::soa_span<bool>>::value, "Wrong column");
+
+FIT_TEST_CASE()
+{
+    fit::soa_vector<float, float, int> points;
+    FIT_TEST_CHECK(points.empty());
+    points.push_back(1.0f, 2.0f, 0);
+    points.push_back(3.0f, 4.0f, 1);
+    FIT_TEST_CHECK(points.size() == 2);
+    for (auto row : points) fit::unpack(scale())(row);
+    auto xs = points.column<0>();
+    FIT_TEST_CHECK(xs.size() == 2);
+    FIT_TEST_CHECK(std::accumulate(xs.begin(), xs.end(), 0.0f) == 8.0f);
+    FIT_TEST_CHECK(xs[1] == 6.0f);
+    FIT_TEST_CHECK(points.column<1>().data()[0] == 4.0f);
+    FIT_TEST_CHECK(fit::unpack(sum_f())(points[1]) == 15.0f);
+}
+
+FIT_TEST_CASE()
+{
+    // The rows are references to the columns
+    fit::soa_vector<int, std::string> v;
+    v.push_back(1, "a");
+    v.push_back(2, std::string("b"));
+    fit::unpack([](int& x, std::string& s) { x = 5; s += "c"; })(v[0]);
+    FIT_TEST_CHECK(v.column<0>()[0] == 5);
+    FIT_TEST_CHECK(v.column<1>()[0] == "ac");
+    const auto& cv = v;
+    FIT_TEST_CHECK(fit::unpack(make_tuple_f())(cv[1]) == std::make_tuple(2, std::string("b")));
+    std::string s;
+    for (auto row : cv) s += fit::unpack([](const int&, const std::string& x) { return x; })(row);
+    FIT_TEST_CHECK(s == "acb");
+}
+
+FIT_TEST_CASE()
+{
+    // The rows can be used with other adaptors
+    fit::soa_vector<int, int> v;
+    for (int i = 0; i < 4; i++) v.push_back(i, i + 1);
+    int sum = 0;
+    for (auto row : v) sum += fit::unpack(fit::by(square(), [](int x, int y) { return x + y; }))(row);
+    FIT_TEST_CHECK(sum == (0 + 1 + 4 + 9) + (1 + 4 + 9 + 16));
+    auto t = fit::unpack(fit::combine(make_tuple_f(), square(), square()))(v[2]);
+    FIT_TEST_CHECK(t == std::make_tuple(4, 9));
+}
+
+FIT_TEST_CASE()
+{
+    fit::soa_vector<int, double> v;
+    v.resize(3);
+    FIT_TEST_CHECK(v.size() == 3);
+    FIT_TEST_CHECK(v.column<1>().size() == 3);
+    v.pop_back();
+    FIT_TEST_CHECK(v.size() == 2);
+    v.reserve(100);
+    FIT_TEST_CHECK(v.size() == 2);
+    v.clear();
+    FIT_TEST_CHECK(v.empty());
+    FIT_TEST_CHECK(v.column<0>().empty());
+}
+
+FIT_TEST_CASE()
+{
+    // The container is unchanged when adding a row throws
+    fit::soa_vector<int, throw_on_copy, int> v;
+    v.reserve(10);
+    throw_on_copy x;
+    throw_on_copy::copies = 0;
+    bool thrown = false;
+    for (int i = 0; i < 5 && !thrown; i++)
+    {
+        try
+        {
+            v.push_back(i, x, i);
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+    }
+    FIT_TEST_CHECK(thrown);
+    FIT_TEST_CHECK(v.size() == 3);
+    FIT_TEST_CHECK(v.column<0>().size() == 3);
+    FIT_TEST_CHECK(v.column<2>().size() == 3);
+}
+
+FIT_TEST_CASE()
+{
+    // The new row can refer to elements of the container
+    fit::soa_vector<int, std::string> v;
+    v.push_back(1, "abc");
+    for (int i = 0; i < 10; i++) v.push_back(v.column<0>()[0], v.column<1>()[0]);
+    for (int i = 0; i < 10; i++) fit::unpack([&](const int& x, const std::string& s) { v.push_back(x + 1, s); })(v[i]);
+    FIT_TEST_CHECK(v.size() == 21);
+    for (std::size_t i = 0; i < v.size(); i++) FIT_TEST_CHECK(v.column<1>()[i] == "abc");
+    FIT_TEST_CHECK(v.column<0>()[20] == 2);
+}
+
+FIT_TEST_CASE()
+{
+    // A bool column holds bools instead of bits
+    fit::soa_vector<int, bool> v;
+    for (int i = 0; i < 5; i++) v.push_back(i, i % 2 == 0);
+    fit::unpack([](int&, bool& b) { b = !b; })(v[0]);
+    FIT_TEST_CHECK(!v.column<1>()[0]);
+    FIT_TEST_CHECK(v.column<1>().data()[2]);
+    FIT_TEST_CHECK(std::count(v.column<1>().begin(), v.column<1>().end(), true) == 2);
+    const auto& cv = v;
+    FIT_TEST_CHECK(fit::unpack(make_tuple_f())(cv[4]) == std::make_tuple(4, true));
+    auto w = v;
+    w.column<1>()[1] = true;
+    FIT_TEST_CHECK(!v.column<1>()[1]);
+    w.resize(7);
+    FIT_TEST_CHECK(w.size() == 7);
+    FIT_TEST_CHECK(!w.column<1>()[6]);
+    w.pop_back();
+    FIT_TEST_CHECK(w.column<1>().size() == 6);
+    v = fit::move(w);
+    FIT_TEST_CHECK(v.size() == 6);
+    v.clear();
+    FIT_TEST_CHECK(v.column<1>().empty());
+}
@@ -0,0 +1,218 @@
+#include <fit/switch.hpp>
+#include <fit/compose.hpp>
+#include <fit/conditional.hpp>
+#include <fit/is_callable.hpp>
+#include <fit/match.hpp>
+#include "test.hpp"
+
+#include <string>
+
+template<int N>
+struct return_n
+{
+    constexpr int operator()() const
+    {
+        return N;
+    }
+};
+
+struct add_class
+{
+    constexpr int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+struct subtract_class
+{
+    constexpr int operator()(int x, int y) const
+    {
+        return x - y;
+    }
+};
+
+struct multiply_class
+{
+    constexpr int operator()(int x, int y) const
+    {
+        return x * y;
+    }
+};
+
+struct is_negative
+{
+    constexpr bool operator()(int x) const
+    {
+        return x < 0;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    // Dense keys
+    auto f = fit::switch_(
+        fit::case_<0>(return_n<10>()),
+        fit::case_<1>(return_n<11>()),
+        fit::case_<3>(return_n<13>()),
+        fit::default_(return_n<-1>())
+    );
+    FIT_TEST_CHECK(f(0) == 10);
+    FIT_TEST_CHECK(f(1) == 11);
+    FIT_TEST_CHECK(f(2) == -1);
+    FIT_TEST_CHECK(f(3) == 13);
+    FIT_TEST_CHECK(f(4) == -1);
+    FIT_TEST_CHECK(f(-1) == -1);
+}
+
+FIT_TEST_CASE()
+{
+    // Sparse keys, declared out of order
+    auto f = fit::switch_(
+        fit::case_<1000>(return_n<3>()),
+        fit::case_<-7>(return_n<1>()),
+        fit::case_<5>(return_n<2>()),
+        fit::case_<1000000>(return_n<4>()),
+        fit::default_(return_n<0>())
+    );
+    FIT_TEST_CHECK(f(-7) == 1);
+    FIT_TEST_CHECK(f(5) == 2);
+    FIT_TEST_CHECK(f(1000) == 3);
+    FIT_TEST_CHECK(f(1000000) == 4);
+    FIT_TEST_CHECK(f(6) == 0);
+    FIT_TEST_CHECK(f(-8) == 0);
+    FIT_TEST_CHECK(f(2000000) == 0);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::switch_(
+        fit::case_<7>(return_n<7>()),
+        fit::when(is_negative(), return_n<-1>()),
+        fit::when([](int x) { return x > 100; }, return_n<100>()),
+        fit::default_(return_n<0>())
+    );
+    FIT_TEST_CHECK(f(7) == 7);
+    FIT_TEST_CHECK(f(-5) == -1);
+    FIT_TEST_CHECK(f(200) == 100);
+    FIT_TEST_CHECK(f(8) == 0);
+}
+
+FIT_TEST_CASE()
+{
+    // Only predicates
+    auto f = fit::switch_(
+        fit::when(is_negative(), return_n<-1>()),
+        fit::default_(return_n<1>())
+    );
+    FIT_TEST_CHECK(f(-5) == -1);
+    FIT_TEST_CHECK(f(5) == 1);
+}
+
+FIT_TEST_CASE()
+{
+    // No default
+    auto f = fit::switch_(
+        fit::case_<1>(return_n<1>()),
+        fit::case_<2>(return_n<2>())
+    );
+    FIT_TEST_CHECK(f(1) == 1);
+    FIT_TEST_CHECK(f(2) == 2);
+    FIT_TEST_CHECK(f(3) == 0);
+}
+
+enum class opcode
+{
+    add,
+    subtract,
+    multiply,
+    halt
+};
+
+typedef std::integral_constant<opcode, opcode::add> add_op;
+typedef std::integral_constant<opcode, opcode::subtract> subtract_op;
+typedef std::integral_constant<opcode, opcode::multiply> multiply_op;
+
+FIT_TEST_CASE()
+{
+    auto exec = fit::switch_(
+        fit::case_(add_op(), add_class()),
+        fit::case_(subtract_op(), subtract_class()),
+        fit::case_(multiply_op(), multiply_class()),
+        fit::default_([](int x, int) { return x; })
+    );
+    FIT_TEST_CHECK(exec(opcode::add, 3, 2) == 5);
+    FIT_TEST_CHECK(exec(opcode::subtract, 3, 2) == 1);
+    FIT_TEST_CHECK(exec(opcode::multiply, 3, 2) == 6);
+    FIT_TEST_CHECK(exec(opcode::halt, 3, 2) == 3);
+
+    const opcode program[] = { opcode::add, opcode::multiply, opcode::subtract, opcode::halt };
+    int acc = 1;
+    for(opcode op : program) acc = exec(op, acc, 2);
+    FIT_TEST_CHECK(acc == 4);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::switch_(
+        fit::case_<1>([](int x) { return long(x); }),
+        fit::case_<2>([](int x) { return x * 2; })
+    );
+    STATIC_ASSERT_SAME(decltype(f(1, 1)), long);
+    FIT_TEST_CHECK(f(1, 5) == 5);
+    FIT_TEST_CHECK(f(2, 5) == 10);
+}
+
+FIT_TEST_CASE()
+{
+    std::string s;
+    auto f = fit::switch_(
+        fit::case_<'a'>([](std::string& x) { x += "a"; }),
+        fit::case_<'b'>([](std::string& x) { x += "b"; }),
+        fit::default_([](std::string& x) { x += "?"; })
+    );
+    for(char c : std::string("abc")) f(c, s);
+    FIT_TEST_CHECK(s == "ab?");
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::compose(
+        fit::switch_(
+            fit::case_<2>(return_n<2>()),
+            fit::default_(return_n<0>())
+        ),
+        [](int x) { return x + 1; }
+    );
+    FIT_TEST_CHECK(f(1) == 2);
+    FIT_TEST_CHECK(f(2) == 0);
+}
+
+static_assert(fit::is_callable<decltype(fit::switch_(fit::case_<1>(add_class()))), int, int, int>::value, "Not callable");
+static_assert(!fit::is_callable<decltype(fit::switch_(fit::case_<1>(add_class()))), int, int>::value, "Callable");
+static_assert(!fit::is_callable<decltype(fit::switch_(fit::case_<1>(add_class()), fit::default_(return_n<0>()))), int, int, int>::value, "Callable");
+static_assert(!fit::is_callable<decltype(fit::switch_(fit::when(is_negative(), add_class()))), int, int>::value, "Callable");
+
+FIT_TEST_CASE()
+{
+    // The switch is only callable when every case can be called
+    auto f = fit::conditional(
+        fit::switch_(
+            fit::case_<0>(add_class()),
+            fit::case_<1>(subtract_class())
+        ),
+        fit::switch_(
+            fit::case_<0>(return_n<10>()),
+            fit::default_(return_n<-1>())
+        )
+    );
+    FIT_TEST_CHECK(f(1, 5, 2) == 3);
+    FIT_TEST_CHECK(f(0) == 10);
+    FIT_TEST_CHECK(f(3) == -1);
+    auto g = fit::match(
+        fit::switch_(fit::case_<0>(add_class())),
+        fit::switch_(fit::case_<0>([](const std::string& x) { return int(x.size()); }))
+    );
+    FIT_TEST_CHECK(g(0, 1, 2) == 3);
+    FIT_TEST_CHECK(g(0, std::string("abcd")) == 4);
+}
@@ -0,0 +1,83 @@
+#include <fit/table.hpp>
+#include <fit/compose.hpp>
+#include <fit/function.hpp>
+#include <fit/is_callable.hpp>
+#include "test.hpp"
+
+#include <cstdint>
+
+struct square_t
+{
+    constexpr int operator()(std::size_t i) const
+    {
+        return i*i;
+    }
+};
+
+struct crc_t
+{
+    constexpr std::uint32_t step(std::uint32_t c, int k) const
+    {
+        return k == 0 ? c : step((c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1), k-1);
+    }
+
+    constexpr std::uint32_t operator()(std::size_t i) const
+    {
+        return step(std::uint32_t(i), 8);
+    }
+};
+
+struct offset_t
+{
+    int n;
+    constexpr offset_t(int x) : n(x)
+    {}
+
+    constexpr int operator()(std::size_t i) const
+    {
+        return i + n;
+    }
+};
+
+FIT_STATIC_FUNCTION(crc_table) = fit::table<256>(crc_t());
+
+static_assert(fit::is_callable<fit::table_adaptor<4, square_t>, int>::value, "Not callable");
+static_assert(!fit::is_callable<fit::table_adaptor<4, square_t>, int, int>::value, "Callable");
+static_assert(!fit::is_callable<fit::table_adaptor<4, square_t>>::value, "Callable");
+static_assert(std::is_same<fit::table_adaptor<4, square_t>::value_type, int>::value, "Wrong value type");
+static_assert(std::is_default_constructible<fit::table_adaptor<4, square_t>>::value, "Not default constructible");
+static_assert(!std::is_default_constructible<fit::table_adaptor<4, offset_t>>::value, "Default constructible");
+
+FIT_TEST_CASE()
+{
+    constexpr auto t = fit::table<8>(square_t());
+    static_assert(t.size() == 8, "Wrong size");
+    static_assert(t(0) == 0, "Table failed");
+    static_assert(t(3) == 9, "Table failed");
+    static_assert(t(7) == 49, "Table failed");
+    for(std::size_t i=0;i<t.size();i++) FIT_TEST_CHECK(t(i) == square_t()(i));
+}
+
+FIT_TEST_CASE()
+{
+    static_assert(crc_table(1) == 0x77073096, "Table failed");
+    static_assert(crc_table(128) == 0xEDB88320, "Table failed");
+    static_assert(crc_table(255) == 0x2D02EF8D, "Table failed");
+    FIT_TEST_CHECK(crc_table(1) == 0x77073096);
+    FIT_TEST_CHECK(&crc_table(0) == &crc_table.data[0]);
+}
+
+FIT_TEST_CASE()
+{
+    constexpr auto t = fit::table<4>(offset_t(10));
+    static_assert(t(0) == 10, "Table failed");
+    static_assert(t(3) == 13, "Table failed");
+    FIT_TEST_CHECK(t(2) == 12);
+}
+
+FIT_TEST_CASE()
+{
+    constexpr auto f = fit::compose(fit::table<8>(square_t()), fit::table<4>(offset_t(2)));
+    FIT_STATIC_TEST_CHECK(f(1) == 9);
+    FIT_TEST_CHECK(f(3) == 25);
+}
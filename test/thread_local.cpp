@@ -0,0 +1,137 @@
+#include <fit/thread_local.hpp>
+#include <fit/is_callable.hpp>
+#include "test.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct counter
+{
+    int n;
+    counter() : n(0)
+    {}
+
+    int operator()(int i)
+    {
+        n += i;
+        return n;
+    }
+};
+
+struct address_f
+{
+    int x;
+    address_f() : x(0)
+    {}
+
+    const int* operator()()
+    {
+        return &x;
+    }
+};
+
+struct const_only_f
+{
+    int operator()(int x) const
+    {
+        return x;
+    }
+};
+
+static_assert(fit::is_callable<fit::thread_local_adaptor<counter>, int>::value, "Not callable");
+static_assert(!fit::is_callable<fit::thread_local_adaptor<counter>>::value, "Callable");
+static_assert(!fit::is_callable<fit::thread_local_adaptor<counter>, int, int>::value, "Callable");
+
+FIT_TEST_CASE()
+{
+    auto f = fit::thread_local_(counter());
+    FIT_TEST_CHECK(f(3) == 3);
+    FIT_TEST_CHECK(f(3) == 6);
+    // Copies of the adaptor share the copy of the thread
+    auto g = f;
+    FIT_TEST_CHECK(g(1) == 7);
+    FIT_TEST_CHECK(f(1) == 8);
+    // Another adaptor has its own copy
+    auto h = fit::thread_local_(counter());
+    FIT_TEST_CHECK(h(1) == 1);
+}
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(fit::thread_local_(const_only_f())(2) == 2);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::thread_local_(address_f());
+    const int* main_address = f();
+    FIT_TEST_CHECK(f() == main_address);
+    std::vector<const int*> addresses(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < addresses.size(); i++)
+    {
+        threads.emplace_back([&, i]
+        {
+            addresses[i] = f();
+            FIT_TEST_CHECK(f() == addresses[i]);
+        });
+    }
+    for (auto& t : threads) t.join();
+    // Each thread has its own copy
+    for (const int* x : addresses) FIT_TEST_CHECK(x != main_address);
+    FIT_TEST_CHECK(f() == main_address);
+}
+
+FIT_TEST_CASE()
+{
+    int total = 0;
+    int merged = 0;
+    {
+        auto f = fit::thread_local_(counter(), [&](const counter& c)
+        {
+            total += c.n;
+            merged++;
+        });
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; i++)
+        {
+            threads.emplace_back([&]
+            {
+                for (int j = 0; j < 1000; j++) f(1);
+            });
+        }
+        for (auto& t : threads) t.join();
+        // The copies of the threads are merged when they exit
+        FIT_TEST_CHECK(total == 4000);
+        FIT_TEST_CHECK(merged == 4);
+        f(5);
+        FIT_TEST_CHECK(total == 4000);
+    }
+    // The copy of this thread is merged when the adaptor is destroyed
+    FIT_TEST_CHECK(total == 4005);
+    FIT_TEST_CHECK(merged == 5);
+}
+
+FIT_TEST_CASE()
+{
+    // A new adaptor doesn't reuse the copy of a destroyed one
+    for (int i = 0; i < 3; i++)
+    {
+        auto f = fit::thread_local_(counter());
+        FIT_TEST_CHECK(f(1) == 1);
+    }
+}
+
+FIT_TEST_CASE()
+{
+    auto p = std::make_shared<int>(0);
+    {
+        auto f = fit::thread_local_([p](int x) { return *p + x; });
+        std::thread t([&] { FIT_TEST_CHECK(f(1) == 1); });
+        t.join();
+        FIT_TEST_CHECK(f(2) == 2);
+    }
+    // The copies are destroyed with the adaptor
+    FIT_TEST_CHECK(p.use_count() == 1);
+}
@@ -0,0 +1,129 @@
+#include <fit/thunk.hpp>
+#include <fit/lazy.hpp>
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct counted_f
+{
+    std::atomic<int>* calls;
+    counted_f(std::atomic<int>* c) : calls(c)
+    {}
+
+    std::vector<int> operator()() const
+    {
+        (*calls)++;
+        return std::vector<int>(100, 1);
+    }
+};
+
+struct repeat_f
+{
+    std::string operator()(std::string s, int n) const
+    {
+        std::string r;
+        for (int i = 0; i < n; i++) r += s;
+        return r;
+    }
+};
+
+struct throw_once_f
+{
+    int* calls;
+    throw_once_f(int* c) : calls(c)
+    {}
+
+    int operator()() const
+    {
+        if ((*calls)++ == 0) throw std::runtime_error("First call");
+        return 5;
+    }
+};
+
+static_assert(std::is_same<fit::thunk_adaptor<counted_f>::value_type, std::vector<int>>::value, "Wrong value type");
+
+FIT_TEST_CASE()
+{
+    std::atomic<int> calls(0);
+    auto f = fit::thunk(counted_f(&calls));
+    FIT_TEST_CHECK(!f.is_ready());
+    FIT_TEST_CHECK(calls == 0);
+    FIT_TEST_CHECK(f().size() == 100);
+    FIT_TEST_CHECK(f.is_ready());
+    FIT_TEST_CHECK(&f() == &f());
+    FIT_TEST_CHECK(calls == 1);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::thunk(fit::lazy(repeat_f())(std::string("ab"), 3));
+    FIT_TEST_CHECK(f() == "ababab");
+}
+
+FIT_TEST_CASE()
+{
+    std::atomic<int> calls(0);
+    auto f = fit::thunk(counted_f(&calls));
+    // A copy made before the call evaluates separately
+    auto g = f;
+    f();
+    auto h = f;
+    FIT_TEST_CHECK(h.is_ready());
+    FIT_TEST_CHECK(h() == f());
+    FIT_TEST_CHECK(&h() != &f());
+    FIT_TEST_CHECK(calls == 1);
+    FIT_TEST_CHECK(!g.is_ready());
+    g();
+    FIT_TEST_CHECK(calls == 2);
+}
+
+FIT_TEST_CASE()
+{
+    int calls = 0;
+    auto f = fit::thunk(throw_once_f(&calls));
+    bool thrown = false;
+    try
+    {
+        f();
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    FIT_TEST_CHECK(thrown);
+    FIT_TEST_CHECK(!f.is_ready());
+    FIT_TEST_CHECK(f() == 5);
+    FIT_TEST_CHECK(f() == 5);
+    FIT_TEST_CHECK(calls == 2);
+}
+
+FIT_TEST_CASE()
+{
+    // All threads ask for the value at the same time
+    std::atomic<int> calls(0);
+    std::atomic<bool> start(false);
+    auto f = fit::thunk(counted_f(&calls));
+    std::vector<const std::vector<int>*> results(8);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        threads.emplace_back([&, i]
+        {
+            while (!start) std::this_thread::yield();
+            results[i] = &f();
+        });
+    }
+    start = true;
+    for (auto& t : threads) t.join();
+    FIT_TEST_CHECK(calls == 1);
+    for (const std::vector<int>* x : results)
+    {
+        FIT_TEST_CHECK(x == &f());
+        FIT_TEST_CHECK(x->size() == 100);
+    }
+}
@@ -0,0 +1,104 @@
+#define FIT_TRACE_BUFFER_SIZE 16
+#include <fit/trace.hpp>
+#include <fit/compose.hpp>
+#include "test.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <cstdio>
+
+static std::size_t count(const std::string& s, const std::string& x)
+{
+    std::size_t n = 0;
+    for (std::size_t i = s.find(x); i != std::string::npos; i = s.find(x, i + 1)) n++;
+    return n;
+}
+
+static std::string flush()
+{
+    std::stringstream ss;
+    fit::trace_write(ss);
+    return ss.str();
+}
+
+struct increment_class
+{
+    constexpr int operator()(int x) const
+    {
+        return x + 1;
+    }
+};
+
+struct twice_class
+{
+    constexpr int operator()(int x) const
+    {
+        return x * 2;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    auto f = fit::trace(binary_class(), "binary");
+    FIT_TEST_CHECK(f(1, 2) == 3);
+    std::string s = flush();
+    FIT_TEST_CHECK(count(s, "{\"name\": \"binary\", \"ph\": \"B\"") == 1);
+    FIT_TEST_CHECK(count(s, "{\"name\": \"binary\", \"ph\": \"E\"") == 1);
+    FIT_TEST_CHECK(s.find("\"traceEvents\"") != std::string::npos);
+    FIT_TEST_CHECK(s.find("\"dropped\": 0") != std::string::npos);
+    // Events are moved out of the buffers
+    FIT_TEST_CHECK(count(flush(), "\"ph\"") == 0);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::flow_traced(increment_class(), twice_class());
+    FIT_TEST_CHECK(f(1) == 4);
+    std::string s = flush();
+    std::string increment = std::string("{\"name\": \"") + fit::detail::type_name<increment_class>() + "\", \"ph\": \"";
+    std::string twice = std::string("{\"name\": \"") + fit::detail::type_name<twice_class>() + "\", \"ph\": \"";
+    FIT_TEST_CHECK(count(s, increment + "B") == 1);
+    FIT_TEST_CHECK(count(s, increment + "E") == 1);
+    FIT_TEST_CHECK(count(s, twice + "B") == 1);
+    FIT_TEST_CHECK(count(s, twice + "E") == 1);
+    FIT_TEST_CHECK(s.find(increment + "E") < s.find(twice + "B"));
+}
+
+FIT_TEST_CASE()
+{
+    auto inner = fit::trace(increment_class(), "inner");
+    auto f = fit::trace(fit::compose(inner, inner), "outer");
+    FIT_TEST_CHECK(f(1) == 3);
+    std::string s = flush();
+    FIT_TEST_CHECK(s.find("\"outer\", \"ph\": \"B\"") < s.find("\"inner\", \"ph\": \"B\""));
+    FIT_TEST_CHECK(s.find("\"inner\", \"ph\": \"E\"") < s.find("\"outer\", \"ph\": \"E\""));
+    FIT_TEST_CHECK(count(s, "\"inner\", \"ph\"") == 4);
+}
+
+FIT_TEST_CASE()
+{
+    // Only 16 events fit in the buffer, so only 8 calls are recorded
+    auto f = fit::trace(increment_class(), "full");
+    for (int i = 0; i < 10; i++) f(i);
+    std::string s = flush();
+    FIT_TEST_CHECK(count(s, "\"full\", \"ph\": \"B\"") == 8);
+    FIT_TEST_CHECK(count(s, "\"full\", \"ph\": \"E\"") == 8);
+    FIT_TEST_CHECK(s.find("\"dropped\": 2") != std::string::npos);
+}
+
+FIT_TEST_CASE()
+{
+    auto f = fit::trace(increment_class(), "threads");
+    std::thread t([&] { f(1); });
+    t.join();
+    f(1);
+    std::string s = flush();
+    FIT_TEST_CHECK(count(s, "\"threads\", \"ph\": \"B\"") == 2);
+    FIT_TEST_CHECK(count(s, "\"threads\", \"ph\": \"E\"") == 2);
+
+    const char* filename = "fit_trace_test.json";
+    f(1);
+    FIT_TEST_CHECK(fit::trace_dump(filename));
+    std::remove(filename);
+}
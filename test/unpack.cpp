@@ -191,3 +191,68 @@ FIT_TEST_CASE()
     STATIC_ASSERT_SAME(deduce_types<int, int, int>, decltype(deduce(fit::pack(1), fit::pack(2), fit::pack(3))));
     // STATIC_ASSERT_SAME(deduce_types<int&&, int&&>, decltype(deduce(fit::pack_forward(1, 2))));
 }
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(3 == fit::unpack(binary_class())(std::make_pair(1, 2)));
+    FIT_TEST_CHECK(3 == binary_unpack(std::make_pair(1, 2)));
+    FIT_STATIC_TEST_CHECK(3 == fit::unpack(binary_class())(std::make_pair(1, 2)));
+
+    std::array<int, 2> a = {{ 1, 2 }};
+    FIT_TEST_CHECK(3 == fit::unpack(binary_class())(a));
+    FIT_TEST_CHECK(3 == binary_unpack(std::array<int, 1>{{ 1 }}, std::make_tuple(2)));
+
+    int c[] = { 1, 2 };
+    const int cc[] = { 1, 2 };
+    FIT_TEST_CHECK(3 == fit::unpack(binary_class())(c));
+    FIT_TEST_CHECK(3 == binary_unpack(cc));
+
+    static_assert(fit::is_unpackable<std::pair<int, int>>::value, "Not unpackable");
+    static_assert(fit::is_unpackable<std::array<int, 3>>::value, "Not unpackable");
+    static_assert(fit::is_unpackable<const int(&)[3]>::value, "Not unpackable");
+}
+
+FIT_TEST_CASE()
+{
+    std::pair<int, int> p(1, 2);
+    fit::unpack([](int& x, int& y) { x++; y++; })(p);
+    FIT_TEST_CHECK(p.first == 2);
+    FIT_TEST_CHECK(p.second == 3);
+
+    std::array<int, 2> a = {{ 1, 2 }};
+    fit::unpack([](int& x, int& y) { x++; y++; })(a);
+    FIT_TEST_CHECK(a[0] == 2);
+    FIT_TEST_CHECK(a[1] == 3);
+
+    int c[] = { 1, 2 };
+    fit::unpack([](int& x, int& y) { x++; y++; })(c);
+    FIT_TEST_CHECK(c[0] == 2);
+    FIT_TEST_CHECK(c[1] == 3);
+}
+
+FIT_TEST_CASE()
+{
+    std::array<std::unique_ptr<int>, 1> a = {{ std::unique_ptr<int>(new int(3)) }};
+    auto p = fit::unpack([](std::unique_ptr<int> x) { return x; })(std::move(a));
+    FIT_TEST_CHECK(3 == *p);
+    FIT_TEST_CHECK(a[0] == nullptr);
+}
+
+#if FIT_HAS_STD_INTEGER_SEQUENCE
+struct sum_constants
+{
+    template<class T, class U>
+    constexpr std::size_t operator()(T, U) const
+    {
+        return T::value + U::value;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    FIT_TEST_CHECK(3 == fit::unpack(sum_constants())(std::index_sequence<1, 2>()));
+    FIT_STATIC_TEST_CHECK(3 == fit::unpack(sum_constants())(std::index_sequence<1, 2>()));
+    auto f = fit::unpack([](std::integral_constant<int, 1>, std::integral_constant<int, 2>) { return 3; });
+    FIT_TEST_CHECK(3 == f(std::integer_sequence<int, 1, 2>()));
+}
+#endif
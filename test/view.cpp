@@ -0,0 +1,162 @@
+#include <fit/view.hpp>
+#include <fit/compose.hpp>
+#include <fit/is_callable.hpp>
+#include <fit/partial.hpp>
+#include <fit/unpack.hpp>
+#include "test.hpp"
+
+#include <forward_list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct is_even
+{
+    bool operator()(int x) const
+    {
+        return x % 2 == 0;
+    }
+};
+
+struct square
+{
+    int operator()(int x) const
+    {
+        return x * x;
+    }
+};
+
+struct add
+{
+    int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+};
+
+// Counts the elements that are computed
+struct counted_square
+{
+    int* calls;
+    counted_square(int* c) : calls(c)
+    {}
+
+    int operator()(int x) const
+    {
+        (*calls)++;
+        return x * x;
+    }
+};
+
+int negate(int x)
+{
+    return -x;
+}
+
+static_assert(fit::is_callable<decltype(fit::transform), std::vector<int>&, square>::value, "Not callable");
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    std::vector<int> r;
+    for (int x : v | fit::filter(is_even()) | fit::transform(square()) | fit::take(3)) r.push_back(x);
+    FIT_TEST_CHECK(r == std::vector<int>({ 4, 16, 36 }));
+
+    // Same as the loop written by hand
+    std::vector<int> expected;
+    for (int x : v)
+    {
+        if (expected.size() == 3) break;
+        if (x % 2 == 0) expected.push_back(x * x);
+    }
+    FIT_TEST_CHECK(r == expected);
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3 };
+    auto t = fit::transform(v, square());
+    FIT_TEST_CHECK(std::accumulate(t.begin(), t.end(), 0) == 14);
+    auto n = fit::transform(v, &negate);
+    FIT_TEST_CHECK(std::accumulate(n.begin(), n.end(), 0) == -6);
+    // Any function of the library can be used
+    auto c = v | fit::transform(fit::compose(square(), fit::partial(add())(1)));
+    FIT_TEST_CHECK(std::accumulate(c.begin(), c.end(), 0) == 4 + 9 + 16);
+}
+
+FIT_TEST_CASE()
+{
+    // Only the elements that are taken are computed
+    int calls = 0;
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6 };
+    int sum = 0;
+    for (int x : v | fit::transform(counted_square(&calls)) | fit::take(2)) sum += x;
+    FIT_TEST_CHECK(sum == 5);
+    FIT_TEST_CHECK(calls == 2);
+    for (int x : v | fit::take(0)) sum += x;
+    FIT_TEST_CHECK(sum == 5);
+    std::vector<int> r;
+    for (int x : v | fit::take(10)) r.push_back(x);
+    FIT_TEST_CHECK(r == v);
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7 };
+    std::vector<int> sums;
+    for (auto c : v | fit::chunk(3)) sums.push_back(std::accumulate(c.begin(), c.end(), 0));
+    FIT_TEST_CHECK(sums == std::vector<int>({ 6, 15, 7 }));
+    std::forward_list<int> l = { 1, 2, 3, 4 };
+    sums.clear();
+    for (auto c : l | fit::chunk(2)) sums.push_back(std::accumulate(c.begin(), c.end(), 0));
+    FIT_TEST_CHECK(sums == std::vector<int>({ 3, 7 }));
+    // There are no chunks of zero elements
+    int chunks = 0;
+    for (auto c : v | fit::chunk(0)) chunks += int(std::distance(c.begin(), c.end())) + 1;
+    FIT_TEST_CHECK(chunks == 0);
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v = { 1, 2, 3, 4 };
+    std::vector<std::string> w = { "a", "b", "c" };
+    std::string s;
+    for (auto x : v | fit::zip(w)) s += std::to_string(std::get<0>(x)) + std::get<1>(x);
+    FIT_TEST_CHECK(s == "1a2b3c");
+    int sum = 0;
+    for (auto x : fit::zip(v, v, v | fit::transform(square()))) sum += std::get<0>(x) + std::get<1>(x) + std::get<2>(x);
+    FIT_TEST_CHECK(sum == 20 + 30);
+    // The elements of the ranges are references
+    for (auto x : fit::zip(v, w)) std::get<0>(x) = 0;
+    FIT_TEST_CHECK(v == std::vector<int>({ 0, 0, 0, 4 }));
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<int> v = { 3, 2, 1 };
+    std::vector<int> w = { 4, 5, 6 };
+    int sum = 0;
+    for (int x : fit::zip(v, w) | fit::transform(fit::unpack(add()))) sum += x;
+    FIT_TEST_CHECK(sum == 21);
+}
+
+FIT_TEST_CASE()
+{
+    std::vector<std::string> v = { "a", "b", "c" };
+    std::string s;
+    for (auto x : v | fit::enumerate) s += std::to_string(x.first) + x.second;
+    FIT_TEST_CHECK(s == "0a1b2c");
+    s.clear();
+    for (auto x : v | fit::filter([](const std::string& x) { return x != "b"; }) | fit::enumerate()) s += std::to_string(x.first) + x.second;
+    FIT_TEST_CHECK(s == "0a1c");
+}
+
+FIT_TEST_CASE()
+{
+    // An rvalue range is moved into the view
+    int sum = 0;
+    for (int x : std::vector<int>({ 1, 2, 3, 4 }) | fit::filter(is_even())) sum += x;
+    FIT_TEST_CHECK(sum == 6);
+    auto t = fit::take(std::vector<int>({ 1, 2, 3 }), 2);
+    FIT_TEST_CHECK(std::accumulate(t.begin(), t.end(), 0) == 3);
+}
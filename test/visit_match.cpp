@@ -0,0 +1,244 @@
+#include <fit/visit_match.hpp>
+#include <fit/match.hpp>
+#include <fit/is_callable.hpp>
+#include "test.hpp"
+
+#include <string>
+
+struct foo
+{};
+
+struct int_or_foo
+{
+    int kind;
+    int i;
+    foo f;
+
+    constexpr int_or_foo(int x) : kind(0), i(x), f()
+    {}
+
+    constexpr int_or_foo(foo x) : kind(1), i(0), f(x)
+    {}
+};
+
+template<std::size_t I>
+struct int_or_foo_get;
+
+template<>
+struct int_or_foo_get<0>
+{
+    template<class V>
+    static constexpr auto apply(V&& v) FIT_RETURNS((v.i));
+};
+
+template<>
+struct int_or_foo_get<1>
+{
+    template<class V>
+    static constexpr auto apply(V&& v) FIT_RETURNS((v.f));
+};
+
+namespace fit {
+
+template<>
+struct variant_traits<int_or_foo>
+{
+    typedef std::integral_constant<std::size_t, 2> size;
+
+    static constexpr std::size_t index(const int_or_foo& v)
+    {
+        return v.kind;
+    }
+
+    template<std::size_t I, class V>
+    constexpr static auto get(V&& v) FIT_RETURNS
+    (
+        int_or_foo_get<I>::apply(fit::forward<V>(v))
+    );
+};
+
+}
+
+struct int_class
+{
+    constexpr int operator()(int x) const
+    {
+        return x;
+    }
+};
+
+struct foo_class
+{
+    constexpr int operator()(foo) const
+    {
+        return -1;
+    }
+};
+
+struct binary_visit
+{
+    constexpr int operator()(int x, int y) const
+    {
+        return x + y;
+    }
+
+    constexpr int operator()(int x, foo) const
+    {
+        return x * 10;
+    }
+
+    constexpr int operator()(foo, int y) const
+    {
+        return y * 100;
+    }
+
+    constexpr int operator()(foo, foo) const
+    {
+        return -2;
+    }
+};
+
+static constexpr fit::match_adaptor<int_class, foo_class> fun = {};
+
+static_assert(fit::is_visitable<int_or_foo>::value, "Not visitable");
+static_assert(fit::is_visitable<const int_or_foo&>::value, "Not visitable");
+static_assert(!fit::is_visitable<int>::value, "Visitable");
+
+FIT_TEST_CASE()
+{
+    int_or_foo i(3);
+    int_or_foo f = foo();
+    FIT_TEST_CHECK(fit::visit_match(fun, i) == 3);
+    FIT_TEST_CHECK(fit::visit_match(fun, f) == -1);
+    FIT_TEST_CHECK(fit::visit_match(fun, int_or_foo(5)) == 5);
+    FIT_TEST_CHECK(fit::visit_match(fit::match(int_class(), foo_class()), f) == -1);
+}
+
+FIT_TEST_CASE()
+{
+    int_or_foo i(3);
+    int_or_foo j(4);
+    int_or_foo f = foo();
+    FIT_TEST_CHECK(fit::visit_match(binary_visit(), i, j) == 7);
+    FIT_TEST_CHECK(fit::visit_match(binary_visit(), i, f) == 30);
+    FIT_TEST_CHECK(fit::visit_match(binary_visit(), f, j) == 400);
+    FIT_TEST_CHECK(fit::visit_match(binary_visit(), f, f) == -2);
+}
+
+struct ternary_visit
+{
+    template<class T, class U, class V>
+    int operator()(T, U, V) const
+    {
+        return index(T()) * 4 + index(U()) * 2 + index(V());
+    }
+
+    static int index(int)
+    {
+        return 0;
+    }
+
+    static int index(foo)
+    {
+        return 1;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    int_or_foo i(1);
+    int_or_foo f = foo();
+    FIT_TEST_CHECK(fit::visit_match(ternary_visit(), i, i, i) == 0);
+    FIT_TEST_CHECK(fit::visit_match(ternary_visit(), i, i, f) == 1);
+    FIT_TEST_CHECK(fit::visit_match(ternary_visit(), i, f, i) == 2);
+    FIT_TEST_CHECK(fit::visit_match(ternary_visit(), f, i, i) == 4);
+    FIT_TEST_CHECK(fit::visit_match(ternary_visit(), f, f, f) == 7);
+}
+
+struct mutate_class
+{
+    void operator()(int& x) const
+    {
+        x++;
+    }
+
+    void operator()(foo&) const
+    {}
+};
+
+FIT_TEST_CASE()
+{
+    int_or_foo i(1);
+    fit::visit_match(mutate_class(), i);
+    FIT_TEST_CHECK(i.i == 2);
+}
+
+FIT_TEST_CASE()
+{
+    int_or_foo i(1);
+    int_or_foo f = foo();
+    auto lam = fit::match(
+        [](int x) { return long(x) + 1; },
+        [](foo) { return 0; }
+    );
+    STATIC_ASSERT_SAME(decltype(fit::visit_match(lam, i)), long);
+    FIT_TEST_CHECK(fit::visit_match(lam, i) == 2);
+    FIT_TEST_CHECK(fit::visit_match(lam, f) == 0);
+}
+
+#if FIT_HAS_STD_VARIANT
+FIT_TEST_CASE()
+{
+    std::variant<int, std::string> v = std::string("hello");
+    auto lam = fit::match(
+        [](int) { return 1; },
+        [](const std::string&) { return 2; }
+    );
+    FIT_TEST_CHECK(fit::visit_match(lam, v) == 2);
+    v = 3;
+    FIT_TEST_CHECK(fit::visit_match(lam, v) == 1);
+}
+#endif
+
+FIT_TEST_CASE()
+{
+    // A function that can't be called with every alternative isn't callable
+    static_assert(!fit::is_callable<decltype(fit::visit_match), int_class, int_or_foo>::value, "Callable");
+    static_assert(fit::is_callable<decltype(fit::visit_match), decltype(fit::match(int_class(), foo_class())), int_or_foo>::value, "Not callable");
+}
+
+#if FIT_HAS_STD_VARIANT
+struct throw_on_move
+{
+    throw_on_move()
+    {}
+
+    throw_on_move(throw_on_move&&)
+    {
+        throw 1;
+    }
+};
+
+FIT_TEST_CASE()
+{
+    // A variant that is valueless by exception can't be visited
+    std::variant<int, throw_on_move> v;
+    try
+    {
+        v.emplace<1>(throw_on_move());
+    }
+    catch (int)
+    {}
+    FIT_TEST_CHECK(v.valueless_by_exception());
+    bool thrown = false;
+    try
+    {
+        fit::visit_match(fit::match([](int) { return 1; }, [](const throw_on_move&) { return 2; }), v);
+    }
+    catch (const std::bad_variant_access&)
+    {
+        thrown = true;
+    }
+    FIT_TEST_CHECK(thrown);
+}
+#endif